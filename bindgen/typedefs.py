@@ -23,8 +23,9 @@ def get_luau_type(type_string, api, is_ret=False, is_obj_nullable=True):
 
     if type_string.startswith(constants.typed_array_prefix):
         array_type_name = type_string.split(":")[-1]
+        array_type = "TypedArray" if is_ret else "TypedArrayLike"
         return (
-            f"TypedArray<{get_luau_type(array_type_name, api, is_obj_nullable=False)}>"
+            f"{array_type}<{get_luau_type(array_type_name, api, is_ret, is_obj_nullable=False)}>"
         )
 
     enum_name = None
@@ -465,7 +466,10 @@ def generate_typedefs(defs_dir, api, lib_types, godot_types):
 -- BUILTIN CLASSES --
 ---------------------
 
-declare class ClassGlobal end
+declare class ClassGlobal
+    GatherProperty: (objects: Array | {Object}, property: string) -> Variant
+    ScatterProperty: (objects: Array | {Object}, property: string, values: Variant) -> ()
+end
 """
     )
 
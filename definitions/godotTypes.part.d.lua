@@ -4,6 +4,7 @@
 
 export type SignalWithArgs<T> = Signal
 export type TypedArray<T> = Array -- TODO: better way?
+export type TypedArrayLike<T> = TypedArray<T> | { T }
 export type integer = number
 
 declare class StringNameN end
@@ -78,3 +78,33 @@ LuauScriptAnalysisResult luascript_analyze(LuauScript *p_script, const char *p_s
 
 	return result;
 }
+
+// Same lookup as ClassReader
+struct ClassTypeFinder : public Luau::AstVisitor {
+	Luau::AstName name;
+	Luau::AstStatTypeAlias *class_type = nullptr;
+
+	bool visit(Luau::AstStatTypeAlias *p_type) override {
+		if (!class_type && p_type->name == name)
+			class_type = p_type;
+
+		return false;
+	}
+
+	ClassTypeFinder(Luau::AstName p_name) :
+			name(p_name) {}
+};
+
+LuauScriptAnalysisResult luascript_find_class_type(const Luau::ParseResult &p_parse_result) {
+	LuauScriptAnalysisResult result;
+
+	result.definition = find_script_definition(p_parse_result.root);
+	if (!result.definition)
+		return result;
+
+	ClassTypeFinder finder(result.definition->name);
+	p_parse_result.root->visit(&finder);
+
+	result.class_type = finder.class_type;
+	return result;
+}
@@ -64,6 +64,7 @@ struct ClassReader : public Luau::AstVisitor {
 private:
 	void handle_definition(Luau::AstStatLocal *p_node);
 	void ann_tool(const Annotation &p_annotation);
+	void ann_process_group(const Annotation &p_annotation);
 	void ann_extends(const Annotation &p_annotation);
 	void ann_permissions(const Annotation &p_annotation);
 	void ann_icon_path(const Annotation &p_annotation);
@@ -100,4 +101,17 @@ struct LuauScriptAnalysisResult {
 	Luau::AstStatTypeAlias *class_type = nullptr;
 };
 
+// What the editor needs to list global classes. Read line by line without parsing the script.
+struct LuauClassHeader {
+	String name;
+	String extends = "RefCounted"; // Godot base type, if there is no base script
+	String base_path;
+	String icon_path;
+};
+
+// Returns false if the script has no class definition.
+bool luascript_scan_class_header(const String &p_path, const char *p_src, LuauClassHeader &r_header);
+
 LuauScriptAnalysisResult luascript_analyze(LuauScript *p_script, const char *p_src, const Luau::ParseResult &p_parse_result, GDClassDefinition &r_def);
+// Finds the class table and type only, without reading annotations. For scripts that were already analyzed.
+LuauScriptAnalysisResult luascript_find_class_type(const Luau::ParseResult &p_parse_result);
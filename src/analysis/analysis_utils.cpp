@@ -238,6 +238,10 @@ static bool get_module_type(Luau::AstStatBlock *p_root, LuauScript *p_script, Lu
 	if (!p_script->add_dependency(required_script))
 		return false;
 
+	// Scripts restored from the disk cache have no syntax tree
+	if (required_script->ensure_syntax_tree() != OK)
+		return false;
+
 	if (Luau::AstStatTypeAlias *class_type = required_script->get_luau_data().analysis_result.class_type) {
 		if (class_type->name != prefix)
 			return false;
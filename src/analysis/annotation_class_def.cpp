@@ -24,6 +24,14 @@ void ClassReader::ann_tool(const Annotation &p_annotation) {
 	class_definition.is_tool = true;
 }
 
+void ClassReader::ann_process_group(const Annotation &p_annotation) {
+	if (!p_annotation.args.is_empty()) {
+		error("@processGroup takes no arguments", p_annotation.location);
+	}
+
+	class_definition.process_group = true;
+}
+
 void ClassReader::ann_extends(const Annotation &p_annotation) {
 	CharString args = p_annotation.args.utf8();
 	const char *ptr = args.get_data();
@@ -157,6 +165,8 @@ void ClassReader::handle_definition(Luau::AstStatLocal *p_node) {
 	for (const Annotation &annotation : annotations) {
 		if (annotation.name == StringName("tool")) {
 			ann_tool(annotation);
+		} else if (annotation.name == StringName("processGroup")) {
+			ann_process_group(annotation);
 		} else if (annotation.name == StringName("extends")) {
 			ann_extends(annotation);
 		} else if (annotation.name == StringName("permissions")) {
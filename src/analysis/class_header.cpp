@@ -0,0 +1,155 @@
+#include "analysis/analysis.h"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/vector.hpp>
+#include <godot_cpp/variant/char_string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <cstring>
+#include <string>
+
+#include "utils/parsing.h"
+#include "utils/wrapped_no_binding.h"
+
+using namespace godot;
+
+// Mirrors ClassReader (annotation_class_def.cpp) and RequireFinder for the common case:
+// a top-level local with a `---` annotation block directly above it, and bases required into top-level locals.
+
+static bool read_word(const char *&ptr, const char *p_word) {
+	size_t len = strlen(p_word);
+
+	if (strncmp(ptr, p_word, len) != 0)
+		return false;
+
+	ptr += len;
+	return true;
+}
+
+static String read_identifier(const char *&ptr) {
+	String out;
+
+	while ((*ptr >= 'a' && *ptr <= 'z') || (*ptr >= 'A' && *ptr <= 'Z') || (*ptr >= '0' && *ptr <= '9') || *ptr == '_') {
+		out += *ptr;
+		ptr++;
+	}
+
+	return out;
+}
+
+// local Name = require("path"), require "path", or with single quotes
+static bool read_require(const char *ptr, String &r_local, String &r_path) {
+	if (!read_word(ptr, "local") || !is_whitespace(*ptr))
+		return false;
+
+	skip_whitespace(ptr);
+	r_local = read_identifier(ptr);
+	skip_whitespace(ptr);
+
+	if (r_local.is_empty() || !read_word(ptr, "="))
+		return false;
+
+	skip_whitespace(ptr);
+
+	if (!read_word(ptr, "require"))
+		return false;
+
+	skip_whitespace(ptr);
+
+	if (*ptr == '(') {
+		ptr++;
+		skip_whitespace(ptr);
+	}
+
+	char quote = *ptr;
+	if (quote != '"' && quote != '\'')
+		return false;
+
+	const char *start = ++ptr;
+
+	while (*ptr && *ptr != quote)
+		ptr++;
+
+	if (*ptr != quote)
+		return false;
+
+	r_path = String::utf8(start, ptr - start);
+	return true;
+}
+
+bool luascript_scan_class_header(const String &p_path, const char *p_src, LuauClassHeader &r_header) {
+	HashMap<String, String> requires;
+	Vector<Annotation> annotations;
+	bool class_found = false;
+
+	const char *line = p_src;
+
+	while (*line) {
+		const char *end = strchr(line, '\n');
+		if (!end)
+			end = line + strlen(line);
+
+		const char *line_end = end;
+		if (line_end > line && *(line_end - 1) == '\r')
+			line_end--;
+
+		std::string line_str(line, line_end - line);
+		const char *ptr = line_str.c_str();
+
+		if (read_word(ptr, "---")) {
+			skip_whitespace(ptr);
+
+			if (*(ptr++) == '@') {
+				Annotation annotation;
+				annotation.name = read_until_whitespace(ptr);
+				annotation.args = read_until_end(ptr).strip_edges();
+
+				if (annotation.name == StringName("class"))
+					class_found = true;
+
+				annotations.push_back(annotation);
+			}
+		} else {
+			ptr = line_str.c_str();
+
+			if (class_found && read_word(ptr, "local") && is_whitespace(*ptr))
+				break;
+
+			String local, path;
+			if (read_require(line_str.c_str(), local, path))
+				requires[local] = path;
+
+			annotations.clear();
+			class_found = false;
+		}
+
+		line = *end ? end + 1 : end;
+	}
+
+	if (!class_found)
+		return false;
+
+	for (const Annotation &annotation : annotations) {
+		CharString args = annotation.args.utf8();
+		const char *ptr = args.get_data();
+
+		if (annotation.name == StringName("class")) {
+			r_header.name = read_until_whitespace(ptr);
+		} else if (annotation.name == StringName("extends")) {
+			String extends = read_until_whitespace(ptr);
+
+			if (nb::ClassDB::get_singleton_nb()->class_exists(extends)) {
+				r_header.extends = extends;
+			} else if (requires.has(extends)) {
+				r_header.extends = "";
+				r_header.base_path = p_path.get_base_dir().path_join(requires[extends] + ".lua").simplify_path();
+			}
+		} else if (annotation.name == StringName("iconPath")) {
+			if (FileAccess::file_exists(annotation.args))
+				r_header.icon_path = annotation.args;
+		}
+	}
+
+	return true;
+}
@@ -137,6 +137,9 @@ static ApiClassType read_class_type(uint64_t &idx) {
 	type.is_enum = read<uint8_t>(idx);
 	type.is_bitfield = read<uint8_t>(idx);
 
+	if (type.type == GDEXTENSION_VARIANT_TYPE_ARRAY)
+		type.array_type = LuauArrayType::from_type_name(type.type_name);
+
 	return type;
 }
 
@@ -41,6 +41,10 @@ struct ApiArgument {
 		static String x;
 		return x;
 	}
+	const LuauArrayType &get_arg_array_type() const {
+		static LuauArrayType x;
+		return x;
+	}
 };
 
 struct ApiArgumentNoDefault {
@@ -52,6 +56,10 @@ struct ApiArgumentNoDefault {
 		static String x;
 		return x;
 	}
+	const LuauArrayType &get_arg_array_type() const {
+		static LuauArrayType x;
+		return x;
+	}
 };
 
 struct ApiEnum {
@@ -170,7 +178,8 @@ struct ApiBuiltinClass {
 
 struct ApiClassType {
 	int32_t type = -1; // GDExtensionVariantType or -1 if none; NIL -> Variant
-	String type_name; // if OBJECT, need to check on set for properties; if bitfield/enum then it's indicated here
+	String type_name; // if OBJECT, need to check on set for properties; if bitfield/enum then it's indicated here; if ARRAY then the element type
+	LuauArrayType array_type; // if ARRAY
 
 	bool is_enum;
 	bool is_bitfield;
@@ -186,6 +195,7 @@ struct ApiClassArgument {
 
 	GDExtensionVariantType get_arg_type() const { return GDExtensionVariantType(type.type); }
 	const String &get_arg_type_name() const { return type.type_name; }
+	const LuauArrayType &get_arg_array_type() const { return type.array_type; }
 };
 
 struct ApiClassMethod {
@@ -49,7 +49,11 @@ void push_enum(lua_State *L, const ApiEnum &p_enum) {
 
 template <typename T>
 _FORCE_INLINE_ static void get_argument(lua_State *L, int p_idx, const T &p_arg, LuauVariant &r_out) {
-	r_out.lua_check(L, p_idx, p_arg.get_arg_type(), p_arg.get_arg_type_name());
+	if (p_arg.get_arg_type() == GDEXTENSION_VARIANT_TYPE_ARRAY) {
+		r_out.lua_check_array(L, p_idx, p_arg.get_arg_array_type());
+	} else {
+		r_out.lua_check(L, p_idx, p_arg.get_arg_type(), p_arg.get_arg_type_name());
+	}
 }
 
 // Defaults
@@ -60,9 +64,7 @@ template <>
 struct has_default_value_trait<ApiArgumentNoDefault> : std::false_type {};
 
 template <typename TMethod, typename TArg>
-_FORCE_INLINE_ static void get_default_args(lua_State *L, int p_arg_offset, int p_nargs, const TMethod &p_method, std::true_type const &) {
-	GDThreadStack &stack = *luaGD_getthreaddata(L)->stack;
-
+_FORCE_INLINE_ static void get_default_args(lua_State *L, int p_arg_offset, int p_nargs, const TMethod &p_method, GDArgFrame &r_frame, std::true_type const &) {
 	for (int i = p_nargs; i < p_method.arguments.size(); i++) {
 		const TArg &arg = p_method.arguments[i];
 
@@ -74,9 +76,9 @@ _FORCE_INLINE_ static void get_default_args(lua_State *L, int p_arg_offset, int
 					ERR_PRINT("Could not set non-null object argument default value");
 				}
 
-				stack.ptr_args[i] = nullptr;
+				r_frame.ptr_args[i] = nullptr;
 			} else {
-				stack.ptr_args[i] = arg.default_value.get_opaque_pointer();
+				r_frame.ptr_args[i] = arg.default_value.get_opaque_pointer();
 			}
 		} else {
 			LuauVariant dummy;
@@ -87,9 +89,7 @@ _FORCE_INLINE_ static void get_default_args(lua_State *L, int p_arg_offset, int
 
 template <>
 _FORCE_INLINE_ void get_default_args<GDMethod, GDProperty>(
-		lua_State *L, int p_arg_offset, int p_nargs, const GDMethod &p_method, std::true_type const &) {
-	GDThreadStack &stack = *luaGD_getthreaddata(L)->stack;
-
+		lua_State *L, int p_arg_offset, int p_nargs, const GDMethod &p_method, GDArgFrame &r_frame, std::true_type const &) {
 	int args_allowed = p_method.arguments.size();
 	int args_default = p_method.default_arguments.size();
 	int args_required = args_allowed - args_default;
@@ -98,7 +98,7 @@ _FORCE_INLINE_ void get_default_args<GDMethod, GDProperty>(
 		const GDProperty &arg = p_method.arguments[i];
 
 		if (i >= args_required) {
-			stack.ptr_args[i] = &p_method.default_arguments[i - args_required];
+			r_frame.ptr_args[i] = &p_method.default_arguments[i - args_required];
 		} else {
 			LuauVariant dummy;
 			get_argument(L, i + 1 + p_arg_offset, arg, dummy);
@@ -107,7 +107,7 @@ _FORCE_INLINE_ void get_default_args<GDMethod, GDProperty>(
 }
 
 template <typename TMethod, typename>
-_FORCE_INLINE_ static void get_default_args(lua_State *L, int p_arg_offset, int p_nargs, const TMethod &p_method, std::false_type const &) {
+_FORCE_INLINE_ static void get_default_args(lua_State *L, int p_arg_offset, int p_nargs, const TMethod &p_method, GDArgFrame &r_frame, std::false_type const &) {
 	LuauVariant dummy;
 	get_argument(L, p_nargs + 1 + p_arg_offset, p_method.arguments[p_nargs], dummy);
 }
@@ -119,55 +119,55 @@ _FORCE_INLINE_ static void get_default_args(lua_State *L, int p_arg_offset, int
 // - T::is_method_vararg
 // - TArg::get_arg_type
 // - TArg::get_arg_type_name
+// - TArg::get_arg_array_type
 template <typename T, typename TArg>
-const GDThreadStack &get_arguments(lua_State *L,
+void get_arguments(lua_State *L,
 		const char *p_method_name,
-		const T &p_method) {
-	GDThreadStack &stack = *luaGD_getthreaddata(L)->stack;
-
+		const T &p_method,
+		GDArgFrame &r_frame) {
 	// arg 1 is self for instance methods
 	int arg_offset = p_method.is_method_static() ? 0 : 1;
 	int nargs = lua_gettop(L) - arg_offset;
 	uint64_t nargs_required = p_method.arguments.size();
 
 	if (nargs_required > nargs)
-		stack.resize(nargs_required);
+		r_frame.alloc(nargs_required);
 	else
-		stack.resize(nargs);
+		r_frame.alloc(nargs);
 
 	if (p_method.is_method_vararg()) {
+		r_frame.has_varargs = true;
 		LuauVariant arg;
 
 		for (int i = 0; i < nargs; i++) {
 			if (i < nargs_required) {
 				get_argument(L, i + 1 + arg_offset, p_method.arguments[i], arg);
-				stack.varargs[i] = arg.to_variant();
+				r_frame.varargs[i] = arg.to_variant();
 			} else {
-				stack.varargs[i] = LuaStackOp<Variant>::check(L, i + 1 + arg_offset);
+				r_frame.varargs[i] = LuaStackOp<Variant>::check(L, i + 1 + arg_offset);
 			}
 
-			stack.ptr_args[i] = &stack.varargs[i];
+			r_frame.ptr_args[i] = &r_frame.varargs[i];
 		}
 	} else {
 		if (nargs > nargs_required)
 			luaL_error(L, "too many arguments to '%s' (expected at most %ld)", p_method_name, nargs_required);
 
 		for (int i = 0; i < nargs; i++) {
-			get_argument(L, i + 1 + arg_offset, p_method.arguments[i], stack.args[i]);
-			stack.ptr_args[i] = stack.args[i].get_opaque_pointer();
+			get_argument(L, i + 1 + arg_offset, p_method.arguments[i], r_frame.args[i]);
+			r_frame.ptr_args[i] = r_frame.args[i].get_opaque_pointer();
 		}
 	}
 
 	if (nargs < nargs_required)
-		get_default_args<T, TArg>(L, arg_offset, nargs, p_method, has_default_value_trait<TArg>());
-
-	return stack;
+		get_default_args<T, TArg>(L, arg_offset, nargs, p_method, r_frame, has_default_value_trait<TArg>());
 }
 
-#define ARGUMENT_TYPE(m_method, m_arg)                                          \
-	template const GDThreadStack &get_arguments<m_method, m_arg>(lua_State * L, \
-			const char *p_method_name,                                          \
-			const m_method &p_method);
+#define ARGUMENT_TYPE(m_method, m_arg)                          \
+	template void get_arguments<m_method, m_arg>(lua_State * L, \
+			const char *p_method_name,                          \
+			const m_method &p_method,                           \
+			GDArgFrame &r_frame);
 
 ARGUMENT_TYPE(ApiVariantMethod, ApiArgument); // Godot builtin classes (e.g. Vector2)
 ARGUMENT_TYPE(ApiClassMethod, ApiClassArgument); // Godot object classes (e.g. RefCounted)
@@ -184,8 +184,7 @@ int luaGD_variant_tostring(lua_State *L) {
 		lua_pushstring(L, "<Freed Object>");
 	} else {
 		Variant v = LuaStackOp<Variant>::check(L, 1);
-		String str = v.stringify();
-		lua_pushstring(L, str.utf8().get_data());
+		LuaStackOp<String>::push(L, v.stringify());
 	}
 
 	return 1;
@@ -11,7 +11,7 @@ using namespace godot;
 struct ApiClass;
 struct ApiClassMethod;
 struct ApiEnum;
-struct GDThreadStack;
+class GDArgFrame;
 
 #define BUILTIN_MT_PREFIX "Godot.Builtin."
 #define BUILTIN_MT_NAME(m_type) BUILTIN_MT_PREFIX #m_type
@@ -48,10 +48,12 @@ void luaGD_initmetatable(lua_State *L, int p_idx, GDExtensionVariantType p_varia
 void luaGD_initglobaltable(lua_State *L, int p_idx, const char *p_global_name);
 ThreadPermissions get_method_permissions(const ApiClass &p_class, const ApiClassMethod &p_method);
 
+// Reads the arguments of a binding call into r_frame, which must outlive the call.
 template <typename T, typename TArg>
-const GDThreadStack &get_arguments(lua_State *L,
+void get_arguments(lua_State *L,
 		const char *p_method_name,
-		const T &p_method);
+		const T &p_method,
+		GDArgFrame &r_frame);
 
 void luaGD_openbuiltins(lua_State *L);
 void luaGD_openclasses(lua_State *L);
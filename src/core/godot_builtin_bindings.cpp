@@ -148,11 +148,10 @@ static int luaGD_builtin_ctor(lua_State *L) {
 	const ApiBuiltinClass *builtin_class = luaGD_lightudataup<ApiBuiltinClass>(L, 1);
 	const char *error_string = lua_tostring(L, lua_upvalueindex(2));
 
-	GDThreadStack &stack = *luaGD_getthreaddata(L)->stack;
-
 	int nargs = lua_gettop(L);
 
-	stack.resize(nargs);
+	GDArgFrame frame(L);
+	frame.alloc(nargs);
 
 	for (const ApiVariantConstructor &ctor : builtin_class->constructors) {
 		if (nargs != ctor.arguments.size())
@@ -168,8 +167,8 @@ static int luaGD_builtin_ctor(lua_State *L) {
 				break;
 			}
 
-			stack.args[i].lua_check(L, i + 1, type);
-			stack.ptr_args[i] = stack.args[i].get_opaque_pointer();
+			frame.args[i].lua_check(L, i + 1, type);
+			frame.ptr_args[i] = frame.args[i].get_opaque_pointer();
 		}
 
 		if (!valid)
@@ -178,7 +177,7 @@ static int luaGD_builtin_ctor(lua_State *L) {
 		LuauVariant ret;
 		ret.initialize(builtin_class->type);
 
-		ctor.func(ret.get_opaque_pointer(), stack.ptr_args);
+		ctor.func(ret.get_opaque_pointer(), frame.ptr_args);
 
 		ret.lua_push(L);
 		return 1;
@@ -268,19 +267,20 @@ static int luaGD_builtin_index(lua_State *L) {
 }
 
 static int call_builtin_method(lua_State *L, const ApiBuiltinClass &p_builtin_class, const ApiVariantMethod &p_method) {
-	const GDThreadStack &stack = get_arguments<ApiVariantMethod, ApiArgument>(L, p_method.name, p_method);
+	GDArgFrame frame(L);
+	get_arguments<ApiVariantMethod, ApiArgument>(L, p_method.name, p_method, frame);
 
 	if (p_method.is_vararg) {
 		Variant ret;
 
 		if (p_method.is_static) {
 			SET_CALL_STACK(L);
-			internal::gdextension_interface_variant_call_static(p_builtin_class.type, &p_method.gd_name, stack.ptr_args, stack.size, &ret, nullptr);
+			internal::gdextension_interface_variant_call_static(p_builtin_class.type, &p_method.gd_name, frame.ptr_args, frame.size, &ret, nullptr);
 			CLEAR_CALL_STACK;
 		} else {
 			Variant self = LuaStackOp<Variant>::check(L, 1);
 			SET_CALL_STACK(L);
-			internal::gdextension_interface_variant_call(&self, &p_method.gd_name, stack.ptr_args, stack.size, &ret, nullptr);
+			internal::gdextension_interface_variant_call(&self, &p_method.gd_name, frame.ptr_args, frame.size, &ret, nullptr);
 			CLEAR_CALL_STACK;
 
 			// HACK: since the value in self is copied,
@@ -314,14 +314,14 @@ static int call_builtin_method(lua_State *L, const ApiBuiltinClass &p_builtin_cl
 			ret.initialize((GDExtensionVariantType)p_method.return_type);
 
 			SET_CALL_STACK(L);
-			p_method.func(self_ptr, stack.ptr_args, ret.get_opaque_pointer(), stack.size);
+			p_method.func(self_ptr, frame.ptr_args, ret.get_opaque_pointer(), frame.size);
 			CLEAR_CALL_STACK;
 
 			ret.lua_push(L);
 			return 1;
 		} else {
 			SET_CALL_STACK(L);
-			p_method.func(self_ptr, stack.ptr_args, nullptr, stack.size);
+			p_method.func(self_ptr, frame.ptr_args, nullptr, frame.size);
 			CLEAR_CALL_STACK;
 			return 0;
 		}
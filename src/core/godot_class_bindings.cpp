@@ -2,6 +2,7 @@
 
 #include <gdextension_interface.h>
 #include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 
 #include "core/extension_api.h"
 #include "core/lua_utils.h"
@@ -68,14 +69,15 @@ static int call_class_method(lua_State *L, const ApiClass &p_class, const ApiCla
 		}
 	}
 
-	const GDThreadStack &stack = get_arguments<ApiClassMethod, ApiClassArgument>(L, p_method.name, p_method);
+	GDArgFrame frame(L);
+	get_arguments<ApiClassMethod, ApiClassArgument>(L, p_method.name, p_method, frame);
 
 	if (p_method.is_vararg) {
 		Variant ret;
 		GDExtensionCallError error;
 
 		SET_CALL_STACK(L);
-		internal::gdextension_interface_object_method_bind_call(p_method.bind, self, stack.ptr_args, stack.size, &ret, &error);
+		internal::gdextension_interface_object_method_bind_call(p_method.bind, self, frame.ptr_args, frame.size, &ret, &error);
 		CLEAR_CALL_STACK;
 
 		if (p_method.return_type.type != -1) {
@@ -100,7 +102,7 @@ static int call_class_method(lua_State *L, const ApiClass &p_class, const ApiCla
 		}
 
 		SET_CALL_STACK(L);
-		internal::gdextension_interface_object_method_bind_ptrcall(p_method.bind, self, stack.ptr_args, ret_ptr);
+		internal::gdextension_interface_object_method_bind_ptrcall(p_method.bind, self, frame.ptr_args, ret_ptr);
 		CLEAR_CALL_STACK;
 
 		if (ret.get_type() != -1) {
@@ -273,6 +275,234 @@ static int call_property_setget(lua_State *L, int p_class_idx, const ApiClassPro
 	luaL_error(L, "setter/getter '%s' was not found", p_method);
 }
 
+static const ApiClassProperty *find_class_property(int p_class_idx, const char *p_name) {
+	const Vector<ApiClass> &classes = get_extension_api().classes;
+
+	while (p_class_idx != -1) {
+		const ApiClass &current_class = classes[p_class_idx];
+
+		HashMapCString<ApiClassProperty>::ConstIterator E = current_class.properties.find(p_name);
+		if (E)
+			return &E->value;
+
+		p_class_idx = current_class.parent_idx;
+	}
+
+	return nullptr;
+}
+
+static const ApiClassMethod *find_class_method(int p_class_idx, const char *p_name, const ApiClass *&r_class) {
+	const Vector<ApiClass> &classes = get_extension_api().classes;
+
+	while (p_class_idx != -1) {
+		const ApiClass &current_class = classes[p_class_idx];
+
+		HashMapCString<ApiClassMethod>::ConstIterator E = current_class.methods.find(p_name);
+		if (E) {
+			r_class = &current_class;
+			return &E->value;
+		}
+
+		p_class_idx = current_class.parent_idx;
+	}
+
+	return nullptr;
+}
+
+// Bulk property access: one pre-resolved setter/getter bind is ptrcalled natively for every object,
+// and values are read from/written to a packed array directly.
+#define BULK_PROPERTY_TYPES(m_op)                                                                      \
+	m_op(GDEXTENSION_VARIANT_TYPE_INT, GDEXTENSION_VARIANT_TYPE_PACKED_INT64_ARRAY, PackedInt64Array)     \
+	m_op(GDEXTENSION_VARIANT_TYPE_FLOAT, GDEXTENSION_VARIANT_TYPE_PACKED_FLOAT64_ARRAY, PackedFloat64Array) \
+	m_op(GDEXTENSION_VARIANT_TYPE_STRING, GDEXTENSION_VARIANT_TYPE_PACKED_STRING_ARRAY, PackedStringArray)  \
+	m_op(GDEXTENSION_VARIANT_TYPE_VECTOR2, GDEXTENSION_VARIANT_TYPE_PACKED_VECTOR2_ARRAY, PackedVector2Array) \
+	m_op(GDEXTENSION_VARIANT_TYPE_VECTOR3, GDEXTENSION_VARIANT_TYPE_PACKED_VECTOR3_ARRAY, PackedVector3Array) \
+	m_op(GDEXTENSION_VARIANT_TYPE_VECTOR4, GDEXTENSION_VARIANT_TYPE_PACKED_VECTOR4_ARRAY, PackedVector4Array) \
+	m_op(GDEXTENSION_VARIANT_TYPE_COLOR, GDEXTENSION_VARIANT_TYPE_PACKED_COLOR_ARRAY, PackedColorArray)
+
+static GDExtensionVariantType get_bulk_packed_type(int32_t p_type) {
+#define BULK_PACKED_TYPE(m_type, m_packed_type, m_packed) \
+	case m_type:                                          \
+		return m_packed_type;
+
+	switch (p_type) {
+		BULK_PROPERTY_TYPES(BULK_PACKED_TYPE)
+
+		default:
+			return GDEXTENSION_VARIANT_TYPE_NIL;
+	}
+
+#undef BULK_PACKED_TYPE
+}
+
+struct BulkPropertyCall {
+	const ApiClassMethod *method = nullptr;
+	int64_t index = -1;
+	LocalVector<GDExtensionObjectPtr> objects;
+};
+
+template <typename T>
+static void bulk_gather(const BulkPropertyCall &p_call, T &r_values) {
+	r_values.resize(p_call.objects.size());
+	auto *values = r_values.ptrw();
+
+	const void *args[1] = { &p_call.index };
+	const void **arg_ptr = p_call.index != -1 ? args : nullptr;
+
+	for (uint32_t i = 0; i < p_call.objects.size(); i++)
+		internal::gdextension_interface_object_method_bind_ptrcall(p_call.method->bind, p_call.objects[i], arg_ptr, &values[i]);
+}
+
+template <typename T>
+static void bulk_scatter(const BulkPropertyCall &p_call, const T &p_values) {
+	const auto *values = p_values.ptr();
+
+	const void *args[2] = { &p_call.index, nullptr };
+	int value_arg = p_call.index != -1 ? 1 : 0;
+
+	for (uint32_t i = 0; i < p_call.objects.size(); i++) {
+		args[value_arg] = &values[i];
+		internal::gdextension_interface_object_method_bind_ptrcall(p_call.method->bind, p_call.objects[i], args, nullptr);
+	}
+}
+
+static const ApiClassProperty &check_bulk_property(lua_State *L, BulkPropertyCall &r_call, bool p_set) {
+	int class_idx = lua_tointeger(L, lua_upvalueindex(1));
+	const ApiClass &g_class = get_extension_api().classes[class_idx];
+
+	LuauArrayType object_type;
+	object_type.type = GDEXTENSION_VARIANT_TYPE_OBJECT;
+	object_type.class_name = g_class.name_str;
+
+	LuauVariant objects;
+	objects.lua_check_array(L, 1, object_type);
+
+	const char *key = luaL_checkstring(L, 2);
+	const ApiClassProperty *prop = find_class_property(class_idx, key);
+
+	if (!prop)
+		luaGD_indexerror(L, key, g_class.name);
+
+	const char *method_name = p_set ? prop->setter : prop->getter;
+
+	if (!*method_name) {
+		if (p_set)
+			luaGD_propreadonlyerror(L, key);
+		else
+			luaGD_propwriteonlyerror(L, key);
+	}
+
+	const ApiClass *method_class = nullptr;
+	r_call.method = find_class_method(class_idx, method_name, method_class);
+
+	if (!r_call.method)
+		luaL_error(L, "setter/getter '%s' was not found", method_name);
+
+	if (!r_call.method->bind)
+		luaL_error(L, "method %s::%s is not present in this Godot build", method_class->name, r_call.method->name);
+
+	luaGD_checkpermissions(L, r_call.method->debug_name, get_method_permissions(*method_class, *r_call.method));
+
+	r_call.index = prop->index;
+
+	// Resolve all objects up front so that no call is made if any of them are invalid
+	const Array &array = *objects.get_ptr<Array>();
+	r_call.objects.resize(array.size());
+
+	for (int i = 0; i < array.size(); i++) {
+		Object *obj = array[i];
+
+		if (!obj)
+			luaL_error(L, "invalid object #%d (object is null or freed)", i + 1);
+
+		GDExtensionObjectPtr ptr = obj->_owner;
+
+		if (!nb::Object(ptr).is_class(g_class.name_str))
+			luaL_error(L, "invalid object #%d (%s expected)", i + 1, g_class.name);
+
+		if (p_set && SandboxService::get_singleton()) {
+			const BitField<ThreadPermissions> *permissions = SandboxService::get_singleton()->get_object_permissions(ptr);
+			if (permissions)
+				luaGD_checkpermissions(L, (nb::Object(ptr).to_string() + "." + r_call.method->name).utf8().get_data(), *permissions);
+		}
+
+		r_call.objects[i] = ptr;
+	}
+
+	return *prop;
+}
+
+#define GATHER_PROPERTY_NAME "GatherProperty"
+#define GATHER_PROPERTY_DBG_NAME "Godot.Object.GatherProperty"
+static int luaGD_class_gatherproperty(lua_State *L) {
+	BulkPropertyCall call;
+	const ApiClassProperty &prop = check_bulk_property(L, call, false);
+
+	int32_t type = call.method->return_type.type;
+	GDExtensionVariantType packed_type = get_bulk_packed_type(type);
+
+	if (packed_type == GDEXTENSION_VARIANT_TYPE_NIL)
+		luaL_error(L, "property '%s' has no packed array type", prop.name);
+
+	LuauVariant values;
+	values.initialize(packed_type);
+
+#define BULK_GATHER(m_type, m_packed_type, m_packed)         \
+	case m_type:                                             \
+		bulk_gather(call, *values.get_ptr<m_packed>()); \
+		break;
+
+	SET_CALL_STACK(L);
+
+	switch (type) {
+		BULK_PROPERTY_TYPES(BULK_GATHER)
+	}
+
+	CLEAR_CALL_STACK;
+
+#undef BULK_GATHER
+
+	values.lua_push(L);
+	return 1;
+}
+
+#define SCATTER_PROPERTY_NAME "ScatterProperty"
+#define SCATTER_PROPERTY_DBG_NAME "Godot.Object.ScatterProperty"
+static int luaGD_class_scatterproperty(lua_State *L) {
+	BulkPropertyCall call;
+	const ApiClassProperty &prop = check_bulk_property(L, call, true);
+
+	// The value is the last setter argument
+	int32_t type = call.method->arguments.is_empty() ? -1 : call.method->arguments[call.method->arguments.size() - 1].type.type;
+	GDExtensionVariantType packed_type = get_bulk_packed_type(type);
+
+	if (packed_type == GDEXTENSION_VARIANT_TYPE_NIL)
+		luaL_error(L, "property '%s' has no packed array type", prop.name);
+
+	LuauVariant values;
+	values.lua_check(L, 3, packed_type);
+
+#define BULK_SCATTER(m_type, m_packed_type, m_packed)                                          \
+	case m_type: {                                                                             \
+		const m_packed &arr = *values.get_ptr<m_packed>();                                     \
+		if (arr.size() != int64_t(call.objects.size()))                                        \
+			luaL_error(L, "expected %d values, got %d", int(call.objects.size()), int(arr.size())); \
+                                                                                               \
+		SET_CALL_STACK(L);                                                                     \
+		bulk_scatter(call, arr);                                                               \
+		CLEAR_CALL_STACK;                                                                      \
+		break;                                                                                 \
+	}
+
+	switch (type) {
+		BULK_PROPERTY_TYPES(BULK_SCATTER)
+	}
+
+#undef BULK_SCATTER
+
+	return 0;
+}
+
 struct CrossVMMethod {
 	LuauScriptInstance *inst;
 	const GDMethod *method;
@@ -285,11 +515,12 @@ static int luaGD_crossvm_call(lua_State *L) {
 	CrossVMMethod m = LuaStackOp<CrossVMMethod>::check(L, 1);
 	lua_remove(L, 1); // To get args
 
-	const GDThreadStack &stack = get_arguments<GDMethod, GDProperty>(L, m.method->name.utf8().get_data(), *m.method);
+	GDArgFrame frame(L);
+	get_arguments<GDMethod, GDProperty>(L, m.method->name.utf8().get_data(), *m.method, frame);
 
 	Variant ret;
 	GDExtensionCallError err;
-	m.inst->call(m.method->name, reinterpret_cast<const Variant *const *>(stack.ptr_args), stack.size, &ret, &err);
+	m.inst->call(m.method->name, reinterpret_cast<const Variant *const *>(frame.ptr_args), frame.size, &ret, &err);
 
 	// Error should have been sent out when getting arguments, so ignore it.
 
@@ -421,7 +652,11 @@ static int luaGD_class_newindex(lua_State *L) {
 
 			LuauScriptInstance::PropertySetGetError err = LuauScriptInstance::PROP_OK;
 			LuauVariant val;
-			val.lua_check(L, 3, prop->property.type);
+			if (prop->property.type == GDEXTENSION_VARIANT_TYPE_ARRAY) {
+				val.lua_check_array(L, 3, prop->property.array_type);
+			} else {
+				val.lua_check(L, 3, prop->property.type);
+			}
 
 			bool is_valid = inst->set(key, val.to_variant(), &err);
 
@@ -554,6 +789,15 @@ void luaGD_openclasses(lua_State *L) {
 			lua_setfield(L, -2, static_method.name);
 		}
 
+		// Bulk property access
+		lua_pushinteger(L, i);
+		lua_pushcclosure(L, luaGD_class_gatherproperty, GATHER_PROPERTY_DBG_NAME, 1);
+		lua_setfield(L, -2, GATHER_PROPERTY_NAME);
+
+		lua_pushinteger(L, i);
+		lua_pushcclosure(L, luaGD_class_scatterproperty, SCATTER_PROPERTY_DBG_NAME, 1);
+		lua_setfield(L, -2, SCATTER_PROPERTY_NAME);
+
 		// Overridden Object methods
 		if (strcmp(g_class.name, "Object") == 0) {
 #define CUSTOM_OBJ_METHOD(m_method, m_name, m_dbg_name) \
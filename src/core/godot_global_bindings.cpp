@@ -13,11 +13,12 @@ using namespace godot;
 static int luaGD_utility_function(lua_State *L) {
 	const ApiUtilityFunction *func = luaGD_lightudataup<ApiUtilityFunction>(L, 1);
 
-	const GDThreadStack &stack = get_arguments<ApiUtilityFunction, ApiArgumentNoDefault>(L, func->name, *func);
+	GDArgFrame frame(L);
+	get_arguments<ApiUtilityFunction, ApiArgumentNoDefault>(L, func->name, *func, frame);
 
 	if (func->return_type == -1) {
 		SET_CALL_STACK(L);
-		func->func(nullptr, stack.ptr_args, stack.size);
+		func->func(nullptr, frame.ptr_args, frame.size);
 		CLEAR_CALL_STACK;
 		return 0;
 	} else {
@@ -25,7 +26,7 @@ static int luaGD_utility_function(lua_State *L) {
 		ret.initialize(GDExtensionVariantType(func->return_type));
 
 		SET_CALL_STACK(L);
-		func->func(ret.get_opaque_pointer(), stack.ptr_args, stack.size);
+		func->func(ret.get_opaque_pointer(), frame.ptr_args, frame.size);
 		CLEAR_CALL_STACK;
 
 		ret.lua_push(L);
@@ -35,23 +36,25 @@ static int luaGD_utility_function(lua_State *L) {
 
 static int luaGD_print_function(lua_State *L) {
 	GDExtensionPtrUtilityFunction func = (GDExtensionPtrUtilityFunction)lua_tolightuserdata(L, lua_upvalueindex(1));
-	GDThreadStack &stack = *luaGD_getthreaddata(L)->stack;
-
 	int nargs = lua_gettop(L);
 
-	stack.resize(nargs);
+	GDArgFrame frame(L);
+	frame.alloc(nargs);
+	frame.has_varargs = true;
 
 	for (int i = 0; i < nargs; i++) {
 		if (LuaStackOp<Variant>::is(L, i + 1)) {
-			stack.varargs[i] = LuaStackOp<Variant>::get(L, i + 1);
+			frame.varargs[i] = LuaStackOp<Variant>::get(L, i + 1);
 		} else {
-			stack.varargs[i] = luaL_tolstring(L, i + 1, nullptr);
+			luaL_tolstring(L, i + 1, nullptr);
+			frame.varargs[i] = LuaStackOp<String>::get(L, -1);
+			lua_pop(L, 1); // string
 		}
 
-		stack.ptr_args[i] = &stack.varargs[i];
+		frame.ptr_args[i] = &frame.varargs[i];
 	}
 
-	func(nullptr, stack.ptr_args, stack.size);
+	func(nullptr, frame.ptr_args, frame.size);
 	return 0;
 }
 
@@ -13,40 +13,99 @@
 #include "core/godot_bindings.h"
 #include "core/permissions.h"
 #include "core/runtime.h"
+#include "core/stack.h"
 #include "utils/wrapped_no_binding.h"
 
 using namespace godot;
 
-void GDThreadStack::resize(uint64_t p_capacity) {
-	size = p_capacity;
-	if (p_capacity <= capacity)
-		return;
+#define ARG_STACK_SEGMENT_SIZE 64
+
+static void free_segment(GDThreadStack::Segment &p_segment) {
+	if (p_segment.args)
+		memdelete_arr(p_segment.args);
+	if (p_segment.varargs)
+		memdelete_arr(p_segment.varargs);
+	if (p_segment.ptr_args)
+		memdelete_arr(p_segment.ptr_args);
 
-	if (args)
-		memdelete_arr(args);
-	if (varargs)
-		memdelete_arr(varargs);
-	if (ptr_args)
-		memdelete_arr(ptr_args);
+	p_segment = GDThreadStack::Segment();
+}
 
-	args = memnew_arr(LuauVariant, p_capacity);
-	varargs = memnew_arr(Variant, p_capacity);
-	ptr_args = memnew_arr(const void *, p_capacity);
+static void alloc_segment(GDThreadStack::Segment &p_segment, uint64_t p_capacity) {
+	free_segment(p_segment);
 
-	capacity = p_capacity;
+	p_segment.args = memnew_arr(LuauVariant, p_capacity);
+	p_segment.varargs = memnew_arr(Variant, p_capacity);
+	p_segment.ptr_args = memnew_arr(const void *, p_capacity);
+	p_segment.capacity = p_capacity;
 }
 
 GDThreadStack::GDThreadStack() {
-	resize(16);
+	segments.resize(1);
+	alloc_segment(segments[0], ARG_STACK_SEGMENT_SIZE);
 }
 
 GDThreadStack::~GDThreadStack() {
-	if (args)
-		memdelete_arr(args);
-	if (varargs)
-		memdelete_arr(varargs);
-	if (ptr_args)
-		memdelete_arr(ptr_args);
+	for (Segment &seg : segments) {
+		free_segment(seg);
+	}
+}
+
+GDArgFrame::GDArgFrame(lua_State *L) :
+		stack(luaGD_getthreaddata(L)->stack) {
+	prev_segment = stack->segment;
+	prev_top = stack->top;
+}
+
+void GDArgFrame::alloc(uint64_t p_size) {
+	ERR_FAIL_COND_MSG(ptr_args, "Argument frame was already allocated");
+
+	size = p_size;
+
+	if (p_size == 0)
+		return;
+
+	if (stack->top + p_size > stack->segments[stack->segment].capacity) {
+		// Segments above the current one are never in use, so they can be (re)allocated freely
+		stack->segment++;
+		stack->top = 0;
+
+		if (stack->segment == stack->segments.size())
+			stack->segments.push_back(GDThreadStack::Segment());
+
+		GDThreadStack::Segment &seg = stack->segments[stack->segment];
+
+		if (seg.capacity < p_size)
+			alloc_segment(seg, MAX(p_size, ARG_STACK_SEGMENT_SIZE));
+	}
+
+	GDThreadStack::Segment &seg = stack->segments[stack->segment];
+	args = seg.args + stack->top;
+	varargs = seg.varargs + stack->top;
+	ptr_args = seg.ptr_args + stack->top;
+
+	stack->top += p_size;
+}
+
+GDArgFrame::~GDArgFrame() {
+	if (ptr_args) {
+		// Release references held by the arguments
+		for (uint64_t i = 0; i < size; i++) {
+			args[i].clear();
+		}
+
+		if (has_varargs) {
+			for (uint64_t i = 0; i < size; i++) {
+				varargs[i] = Variant();
+			}
+		}
+
+		if (stack->top != uint64_t(ptr_args - stack->segments[stack->segment].ptr_args) + size)
+			ERR_PRINT("Argument frames were released out of order");
+	}
+
+	stack->segment = prev_segment;
+	stack->top = prev_top;
 }
 
 // Based on the default implementation seen in the Lua 5.1 reference
@@ -61,19 +120,80 @@ static void *luaGD_alloc(void *, void *p_ptr, size_t, size_t p_nsize) {
 	return memrealloc(p_ptr, p_nsize);
 }
 
+void GDScriptRef::release() {
+	if (shared && --shared->refcount == 0)
+		memdelete(shared);
+
+	shared = nullptr;
+}
+
+GDScriptRef &GDScriptRef::operator=(const GDScriptRef &p_other) {
+	if (shared == p_other.shared)
+		return *this;
+
+	release();
+
+	shared = p_other.shared;
+	if (shared)
+		shared->refcount++;
+
+	return *this;
+}
+
+GDScriptRef &GDScriptRef::operator=(const Ref<LuauScript> &p_script) {
+	release();
+
+	if (p_script.is_valid()) {
+		shared = memnew(Shared);
+		shared->script = p_script;
+	}
+
+	return *this;
+}
+
+GDScriptRef::GDScriptRef(const GDScriptRef &p_other) {
+	*this = p_other;
+}
+
+#define THREAD_DATA_POOL_MAX 4096
+
+GDThreadDataPool::~GDThreadDataPool() {
+	for (GDThreadData *udata : free) {
+		memdelete(udata);
+	}
+}
+
+static void luaGD_inheritthreaddata(const GDThreadData *p_parent, GDThreadData *r_udata) {
+	r_udata->vm_type = p_parent->vm_type;
+	r_udata->permissions = p_parent->permissions;
+	r_udata->lock = p_parent->lock;
+	r_udata->script = p_parent->script;
+	r_udata->stack = p_parent->stack;
+	r_udata->thread_pool = p_parent->thread_pool;
+	r_udata->data_pool = p_parent->data_pool;
+	r_udata->atoms = p_parent->atoms;
+}
+
 static GDThreadData *luaGD_initthreaddata(lua_State *LP, lua_State *L) {
-	GDThreadData *udata = memnew(GDThreadData);
-	lua_setthreaddata(L, udata);
+	GDThreadData *udata = nullptr;
 
 	if (LP) {
 		GDThreadData *parent_udata = luaGD_getthreaddata(LP);
-		udata->vm_type = parent_udata->vm_type;
-		udata->permissions = parent_udata->permissions;
-		udata->lock = parent_udata->lock;
-		udata->script = parent_udata->script;
-		udata->stack = parent_udata->stack;
+		GDThreadDataPool *pool = parent_udata->data_pool;
+
+		if (pool && !pool->free.is_empty()) {
+			udata = pool->free[pool->free.size() - 1];
+			pool->free.resize(pool->free.size() - 1);
+		} else {
+			udata = memnew(GDThreadData);
+		}
+
+		luaGD_inheritthreaddata(parent_udata, udata);
+	} else {
+		udata = memnew(GDThreadData);
 	}
 
+	lua_setthreaddata(L, udata);
 	return udata;
 }
 
@@ -84,7 +204,14 @@ static void luaGD_userthread(lua_State *LP, lua_State *L) {
 		GDThreadData *udata = luaGD_getthreaddata(L);
 		if (udata) {
 			lua_setthreaddata(L, nullptr);
-			memdelete(udata);
+
+			GDThreadDataPool *pool = udata->data_pool;
+			*udata = GDThreadData();
+
+			if (pool && pool->free.size() < THREAD_DATA_POOL_MAX)
+				pool->free.push_back(udata);
+			else
+				memdelete(udata);
 		}
 	}
 }
@@ -101,11 +228,15 @@ lua_State *luaGD_newstate(LuauRuntime::VMType p_vm_type, BitField<ThreadPermissi
 	GDThreadData *udata = luaGD_initthreaddata(nullptr, L);
 	udata->vm_type = p_vm_type;
 	udata->permissions = p_base_permissions;
-	udata->lock.instantiate();
+	udata->lock = memnew(GDVMLock);
 	udata->stack = memnew(GDThreadStack);
+	udata->thread_pool = memnew(GDThreadPool);
+	udata->data_pool = memnew(GDThreadDataPool);
+	udata->atoms = memnew(GDStringAtoms);
 
 	lua_Callbacks *callbacks = lua_callbacks(L);
 	callbacks->userthread = luaGD_userthread;
+	callbacks->useratom = luaGD_useratom;
 
 	return L;
 }
@@ -123,17 +254,76 @@ GDThreadData *luaGD_getthreaddata(lua_State *L) {
 	return reinterpret_cast<GDThreadData *>(lua_getthreaddata(L));
 }
 
+#define THREAD_POOL_MAX 64
+
+lua_State *luaGD_borrowthread(const ThreadHandle &L) {
+	GDThreadData *parent_udata = luaGD_getthreaddata(L);
+	GDThreadPool *pool = parent_udata->thread_pool;
+
+	if (pool->free.is_empty()) {
+		lua_State *T = lua_newthread(L);
+		luaGD_getthreaddata(T)->pool_ref = lua_ref(L, -1);
+		lua_pop(L, 1); // thread
+
+		return T;
+	}
+
+	GDThreadPool::Entry entry = pool->free[pool->free.size() - 1];
+	pool->free.resize(pool->free.size() - 1);
+
+	lua_State *T = entry.thread;
+
+	GDThreadData *udata = luaGD_getthreaddata(T);
+	luaGD_inheritthreaddata(parent_udata, udata);
+	udata->interrupt_deadline = 0;
+	udata->pool_ref = entry.ref;
+
+	// Same environment as lua_newthread would give
+	lua_pushvalue(L, LUA_GLOBALSINDEX);
+	lua_xmove(L, T, 1);
+	lua_replace(T, LUA_GLOBALSINDEX);
+
+	return T;
+}
+
+void luaGD_releasethread(const ThreadHandle &L, lua_State *T) {
+	GDThreadData *udata = luaGD_getthreaddata(T);
+	GDThreadPool *pool = udata->thread_pool;
+
+	int ref = udata->pool_ref;
+	udata->pool_ref = 0;
+
+	if (lua_status(T) == LUA_YIELD || pool->free.size() >= THREAD_POOL_MAX) {
+		lua_unref(L, ref);
+		return;
+	}
+
+	lua_resetthread(T);
+	udata->script.unref();
+
+	GDThreadPool::Entry entry;
+	entry.thread = T;
+	entry.ref = ref;
+	pool->free.push_back(entry);
+}
+
 void luaGD_close(lua_State *L) {
 	L = lua_mainthread(L);
 
 	GDThreadData *udata = luaGD_getthreaddata(L);
+	lua_setthreaddata(L, nullptr);
+
+	// Remaining threads return their data to the pool while closing
+	lua_close(L);
+
 	if (udata) {
-		lua_setthreaddata(L, nullptr);
 		memdelete(udata->stack);
+		memdelete(udata->thread_pool); // threads are collected by lua_close
+		memdelete(udata->data_pool);
+		memdelete(udata->atoms);
+		memdelete(udata->lock);
 		memdelete(udata);
 	}
-
-	lua_close(L);
 }
 
 bool luaGD_getfield(lua_State *L, int p_index, const char *p_key) {
@@ -3,11 +3,11 @@
 #include <Luau/Compiler.h>
 #include <lua.h>
 #include <lualib.h>
-#include <godot_cpp/classes/mutex.hpp>
 #include <godot_cpp/classes/ref.hpp>
 #include <godot_cpp/core/method_ptrcall.hpp> // TODO: unused. required to prevent compile error when specializing PtrToArg.
 #include <godot_cpp/core/mutex_lock.hpp>
 #include <godot_cpp/core/type_info.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
@@ -43,34 +43,120 @@ enum UserdataTags {
 
 // A sort of "virtual stack" that stores arguments. Prevents reallocating these
 // frequently on hot paths.
+// Storage is split into segments which are claimed by GDArgFrame in LIFO order, so nested calls
+// (e.g. an engine method calling back into Luau) never overwrite or reallocate the arguments of an
+// outer call. Segments are kept once allocated.
 struct GDThreadStack {
+	struct Segment {
+		LuauVariant *args = nullptr;
+		Variant *varargs = nullptr;
+		const void **ptr_args = nullptr;
+
+		uint64_t capacity = 0;
+	};
+
+	LocalVector<Segment> segments;
+	uint64_t segment = 0;
+	uint64_t top = 0;
+
+	GDThreadStack();
+	~GDThreadStack();
+};
+
+// Arguments for one binding call. Released when it goes out of scope.
+class GDArgFrame {
+	GDThreadStack *stack;
+	uint64_t prev_segment;
+	uint64_t prev_top;
+
+public:
 	LuauVariant *args = nullptr;
 	Variant *varargs = nullptr;
 	const void **ptr_args = nullptr;
 
 	uint64_t size = 0;
-	uint64_t capacity = 0;
+	bool has_varargs = false;
 
-	void resize(uint64_t p_capacity);
+	void alloc(uint64_t p_size);
 
-	GDThreadStack();
-	~GDThreadStack();
+	explicit GDArgFrame(lua_State *L);
+	~GDArgFrame();
+
+	GDArgFrame(const GDArgFrame &) = delete;
+	GDArgFrame &operator=(const GDArgFrame &) = delete;
+};
+
+// Threads reused for calls into Luau from the engine. Shared by all threads in a VM.
+struct GDThreadPool {
+	struct Entry {
+		lua_State *thread = nullptr;
+		int ref = 0;
+	};
+
+	LocalVector<Entry> free;
 };
 
+// Script reference shared by a thread and the threads created from it, so that creating a thread
+// does not touch the script's (atomic) reference count. Not thread-safe on its own: threads are only
+// created and collected while their VM is locked.
+class GDScriptRef {
+	struct Shared {
+		Ref<LuauScript> script;
+		uint32_t refcount = 1;
+	};
+
+	Shared *shared = nullptr;
+
+	void release();
+
+public:
+	LuauScript *ptr() const { return shared ? shared->script.ptr() : nullptr; }
+	LuauScript *operator->() const { return ptr(); }
+
+	bool is_null() const { return !shared; }
+	bool is_valid() const { return shared; }
+	void unref() { release(); }
+
+	GDScriptRef &operator=(const GDScriptRef &p_other);
+	GDScriptRef &operator=(const Ref<LuauScript> &p_script);
+
+	GDScriptRef() {}
+	GDScriptRef(const GDScriptRef &p_other);
+	~GDScriptRef() { release(); }
+};
+
+struct GDThreadDataPool;
+
 struct GDThreadData {
 	LuauRuntime::VMType vm_type = LuauRuntime::VM_MAX;
 	BitField<ThreadPermissions> permissions = 0;
-	Ref<Mutex> lock;
+	GDVMLock *lock = nullptr; // Owned by the VM
 	uint64_t interrupt_deadline = 0;
 
-	Ref<LuauScript> script;
+	GDScriptRef script;
 
 	GDThreadStack *stack = nullptr;
+	GDThreadPool *thread_pool = nullptr;
+	GDThreadDataPool *data_pool = nullptr;
+	GDStringAtoms *atoms = nullptr;
+	int pool_ref = 0; // only set while the thread is borrowed
+};
+
+// Recycles GDThreadData of collected threads. Shared by all threads in a VM.
+struct GDThreadDataPool {
+	LocalVector<GDThreadData *> free;
+
+	~GDThreadDataPool();
 };
 
 lua_State *luaGD_newstate(LuauRuntime::VMType p_vm_type, BitField<ThreadPermissions> p_base_permissions);
 lua_State *luaGD_newthread(lua_State *L, BitField<ThreadPermissions> p_permissions);
 GDThreadData *luaGD_getthreaddata(lua_State *L);
+// Gets a thread which behaves like a new thread of L without leaving anything on L's stack.
+// Must be returned with luaGD_releasethread. Threads which are yielded on release are left to
+// whatever resumes them (e.g. the task scheduler).
+lua_State *luaGD_borrowthread(const ThreadHandle &L);
+void luaGD_releasethread(const ThreadHandle &L, lua_State *T);
 void luaGD_close(lua_State *L);
 
 bool luaGD_getfield(lua_State *L, int p_index, const char *p_key);
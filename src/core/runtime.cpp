@@ -3,7 +3,6 @@
 #include <Luau/CodeGen.h>
 #include <lua.h>
 #include <lualib.h>
-#include <godot_cpp/classes/mutex.hpp>
 
 #include "core/lua_utils.h"
 #include "core/permissions.h"
@@ -15,12 +14,12 @@ using namespace godot;
 
 ThreadHandle::ThreadHandle(lua_State *L) :
 		L(L) {
-	if (Mutex *mut = luaGD_getthreaddata(L)->lock.ptr())
+	if (GDVMLock *mut = luaGD_getthreaddata(L)->lock)
 		mut->lock();
 }
 
 ThreadHandle::~ThreadHandle() {
-	if (Mutex *mut = luaGD_getthreaddata(L)->lock.ptr())
+	if (GDVMLock *mut = luaGD_getthreaddata(L)->lock)
 		mut->unlock();
 }
 
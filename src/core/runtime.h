@@ -1,12 +1,46 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <godot_cpp/core/mutex_lock.hpp>
+#include <mutex>
+#include <thread>
 
 using namespace godot;
 
 struct lua_State;
 
+// Recursive lock guarding a VM. Re-entering from the thread that holds it (e.g. nested calls
+// between Godot and Luau) does not touch the underlying mutex.
+class GDVMLock {
+	std::mutex mutex;
+	std::atomic<std::thread::id> owner;
+	uint32_t depth = 0; // Only accessed by the owner
+
+public:
+	void lock() {
+		std::thread::id self = std::this_thread::get_id();
+
+		// Only this thread ever stores its own id, so a relaxed load is enough to detect re-entry
+		if (owner.load(std::memory_order_relaxed) == self) {
+			depth++;
+			return;
+		}
+
+		mutex.lock();
+		owner.store(self, std::memory_order_relaxed);
+		depth = 1;
+	}
+
+	void unlock() {
+		if (--depth > 0)
+			return;
+
+		owner.store(std::thread::id(), std::memory_order_relaxed);
+		mutex.unlock();
+	}
+};
+
 class ThreadHandle {
 public:
 	ThreadHandle(lua_State *L);
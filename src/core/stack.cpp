@@ -3,12 +3,14 @@
 #include <gdextension_interface.h>
 #include <lua.h>
 #include <lualib.h>
-#include <cmath>
 #include <godot_cpp/classes/object.hpp>
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/godot.hpp>
+#include <godot_cpp/variant/node_path.hpp>
 #include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
 #include <godot_cpp/variant/variant.hpp>
+#include <cstring>
 
 #include "core/godot_bindings.h"
 #include "core/lua_utils.h"
@@ -129,12 +131,120 @@ int64_t LuaStackOp<int64_t>::check(lua_State *L, int p_index) {
 
 /* STRING */
 
+// Strings are transcoded directly between Luau's UTF-8 and Godot's UTF-32 storage to avoid an intermediate
+// CharString. ASCII, the common case, is detected a word at a time and widened/narrowed in a flat loop.
+
+#define ASCII_WORD_MASK 0x8080808080808080ULL
+
+static _FORCE_INLINE_ bool utf8_is_ascii(const char *p_str, size_t p_len) {
+	size_t i = 0;
+
+	for (; i + sizeof(uint64_t) <= p_len; i += sizeof(uint64_t)) {
+		uint64_t word;
+		memcpy(&word, p_str + i, sizeof(uint64_t));
+
+		if (word & ASCII_WORD_MASK)
+			return false;
+	}
+
+	for (; i < p_len; i++) {
+		if (uint8_t(p_str[i]) & 0x80)
+			return false;
+	}
+
+	return true;
+}
+
+// Invalid code points (surrogates, > U+10FFFF) are encoded as U+FFFD, which is also 3 bytes.
+static _FORCE_INLINE_ size_t utf8_encoded_len(char32_t c) {
+	if (c < 0x80)
+		return 1;
+	else if (c < 0x800)
+		return 2;
+	else if (c < 0x10000 || c > 0x10ffff)
+		return 3;
+	else
+		return 4;
+}
+
+static _FORCE_INLINE_ char *utf8_encode(char32_t c, char *w) {
+	if (c < 0x80) {
+		*(w++) = char(c);
+	} else if (c < 0x800) {
+		*(w++) = char(0xc0 | (c >> 6));
+		*(w++) = char(0x80 | (c & 0x3f));
+	} else if (c < 0x10000 || c > 0x10ffff) {
+		if (c > 0x10ffff || (c >= 0xd800 && c <= 0xdfff))
+			c = 0xfffd;
+
+		*(w++) = char(0xe0 | (c >> 12));
+		*(w++) = char(0x80 | ((c >> 6) & 0x3f));
+		*(w++) = char(0x80 | (c & 0x3f));
+	} else {
+		*(w++) = char(0xf0 | (c >> 18));
+		*(w++) = char(0x80 | ((c >> 12) & 0x3f));
+		*(w++) = char(0x80 | ((c >> 6) & 0x3f));
+		*(w++) = char(0x80 | (c & 0x3f));
+	}
+
+	return w;
+}
+
 void LuaStackOp<String>::push(lua_State *L, const String &p_value) {
-	lua_pushstring(L, p_value.utf8().get_data());
+	const char32_t *src = p_value.ptr();
+	int64_t len = p_value.length();
+
+	char32_t all_bits = 0;
+	size_t utf8_len = 0;
+
+	for (int64_t i = 0; i < len; i++) {
+		all_bits |= src[i];
+		utf8_len += utf8_encoded_len(src[i]);
+	}
+
+	// Writes directly into the string's storage if it does not fit in the buffer on the C stack
+	luaL_Strbuf b;
+	char *w = luaL_buffinitsize(L, &b, utf8_len);
+
+	if (all_bits < 0x80) {
+		for (int64_t i = 0; i < len; i++) {
+			w[i] = char(src[i]);
+		}
+	} else {
+		for (int64_t i = 0; i < len; i++) {
+			w = utf8_encode(src[i], w);
+		}
+	}
+
+	luaL_pushresultsize(&b, utf8_len);
+}
+
+static String luaGD_tostring(const char *p_str, size_t p_len) {
+	if (p_len == 0)
+		return String();
+
+	// Leave validation and error reporting of non-ASCII input to Godot
+	if (!utf8_is_ascii(p_str, p_len))
+		return String::utf8(p_str, p_len);
+
+	String str;
+	str.resize(p_len + 1);
+	char32_t *w = str.ptrw();
+
+	for (size_t i = 0; i < p_len; i++) {
+		w[i] = char32_t(uint8_t(p_str[i]));
+	}
+
+	w[p_len] = 0;
+
+	return str;
 }
 
 String LuaStackOp<String>::get(lua_State *L, int p_index) {
-	return String::utf8(lua_tostring(L, p_index));
+	size_t len = 0;
+	const char *str = lua_tolstring(L, p_index, &len);
+
+	return str ? luaGD_tostring(str, len) : String();
 }
 
 bool LuaStackOp<String>::is(lua_State *L, int p_index) {
@@ -142,7 +252,10 @@ bool LuaStackOp<String>::is(lua_State *L, int p_index) {
 }
 
 String LuaStackOp<String>::check(lua_State *L, int p_index) {
-	return String::utf8(luaL_checkstring(L, p_index));
+	size_t len = 0;
+	const char *str = luaL_checklstring(L, p_index, &len);
+
+	return luaGD_tostring(str, len);
 }
 
 /* OBJECTS */
@@ -341,10 +454,10 @@ int LuaStackOp<Variant>::get_type(lua_State *L, int p_index) {
 
 		case LUA_TNUMBER: {
 			// Somewhat frail...
+			// Range check first: casting an out of range double to int64_t is undefined.
 			double value = lua_tonumber(L, p_index);
-			double int_part = 0.0;
 
-			if (std::modf(value, &int_part) == 0.0)
+			if (value >= -INT64_DOUBLE_LIMIT && value <= INT64_DOUBLE_LIMIT && double(int64_t(value)) == value)
 				return GDEXTENSION_VARIANT_TYPE_INT;
 			else
 				return GDEXTENSION_VARIANT_TYPE_FLOAT;
@@ -354,21 +467,18 @@ int LuaStackOp<Variant>::get_type(lua_State *L, int p_index) {
 			return GDEXTENSION_VARIANT_TYPE_STRING;
 
 		case LUA_TUSERDATA: {
-			// Special case
-			if (LuaStackOp<int64_t>::is(L, p_index))
-				return GDEXTENSION_VARIANT_TYPE_INT;
-
-			if (!lua_getmetatable(L, p_index))
-				return -1;
+			// All Variant userdata is tagged with its type (see UDATA_ALLOC and ObjectUdata)
+			int tag = lua_userdatatag(L, p_index);
 
-			lua_getfield(L, -1, MT_VARIANT_TYPE);
-			if (lua_isnil(L, -1))
-				return -1;
+			// Tag 0 is the default for untagged userdata (lua_newuserdata, newproxy), so it never maps to NIL
+			if (tag > GDEXTENSION_VARIANT_TYPE_NIL && tag < GDEXTENSION_VARIANT_TYPE_VARIANT_MAX)
+				return tag;
 
-			int type = lua_tonumber(L, -1);
-			lua_pop(L, 2); // value, metatable
+			// Special case
+			if (tag == UDATA_TAG_INT64)
+				return GDEXTENSION_VARIANT_TYPE_INT;
 
-			return type;
+			return -1;
 		}
 
 		default:
@@ -389,6 +499,74 @@ Variant LuaStackOp<Variant>::check(lua_State *L, int p_index) {
 
 /* STRING COERCION */
 
+// Luau strings are assigned an atom (stored in the string object) the second time they are converted to a
+// StringName/NodePath, so converting them again (e.g. a literal in a loop) is an array lookup rather than a trip
+// through the engine's global StringName table. Strings converted only once, such as ones built at runtime, never
+// take an entry.
+// Atoms index a table owned by the VM. The useratom callback does not receive the VM, so the converting VM's table is
+// passed through a thread-local. Luau has no hook for collected strings, so entries live until the VM is closed.
+
+#define STRING_ATOM_MAX 32767
+// ATOM_UNDEF (lstring.h): the string is not atomized and the callback runs again on its next conversion
+#define STRING_ATOM_UNDEF -32768
+
+static thread_local GDStringAtoms *converting_atoms = nullptr;
+
+int16_t luaGD_useratom(const char *p_str, size_t p_len) {
+	GDStringAtoms *atoms = converting_atoms;
+	if (!atoms)
+		return STRING_ATOM_UNDEF;
+
+	// Strings are identified by address, which is stable for as long as they are alive
+	const char *&seen = atoms->seen[(uintptr_t(p_str) >> 3) % STRING_ATOM_SEEN_SIZE];
+	if (seen != p_str) {
+		seen = p_str;
+		return STRING_ATOM_UNDEF;
+	}
+
+	seen = nullptr;
+
+	// Out of atoms; conversion falls back to constructing the value each time
+	if (atoms->entries.size() >= STRING_ATOM_MAX)
+		return -1;
+
+	int16_t atom = atoms->entries.size();
+	atoms->entries.push_back(GDStringAtoms::Entry());
+	atoms->entries[atom].string_name = String::utf8(p_str, p_len);
+
+	return atom;
+}
+
+static GDStringAtoms::Entry *luaGD_getstringatom(lua_State *L, int p_index) {
+	GDThreadData *udata = luaGD_getthreaddata(L);
+	if (!udata || !udata->atoms)
+		return nullptr;
+
+	int atom = -1;
+
+	converting_atoms = udata->atoms;
+	bool is_string = lua_tostringatom(L, p_index, &atom);
+	converting_atoms = nullptr;
+
+	if (!is_string || atom < 0)
+		return nullptr;
+
+	return &udata->atoms->entries[atom];
+}
+
+static const StringName &luaGD_atomStringName(GDStringAtoms::Entry *p_atom) {
+	return p_atom->string_name;
+}
+
+static const NodePath &luaGD_atomNodePath(GDStringAtoms::Entry *p_atom) {
+	if (!p_atom->has_node_path) {
+		p_atom->node_path = String(p_atom->string_name);
+		p_atom->has_node_path = true;
+	}
+
+	return p_atom->node_path;
+}
+
 #define STR_STACK_OP_IMPL(m_type, m_tag)                                                    \
 	UDATA_ALLOC(m_type, m_tag, DTOR(m_type))                                                \
                                                                                             \
@@ -407,19 +585,26 @@ Variant LuaStackOp<Variant>::check(lua_State *L, int p_index) {
                                                                                             \
 	UDATA_GET_PTR(m_type, m_tag)                                                            \
                                                                                             \
+	static m_type luaGD_tostr##m_type(lua_State *L, int p_index) {                          \
+		if (GDStringAtoms::Entry *atom = luaGD_getstringatom(L, p_index))                   \
+			return luaGD_atom##m_type(atom);                                                \
+                                                                                            \
+		return m_type(lua_tostring(L, p_index));                                            \
+	}                                                                                       \
+                                                                                            \
 	m_type LuaStackOp<m_type>::get(lua_State *L, int p_index) {                             \
 		m_type *udata = LuaStackOp<m_type>::get_ptr(L, p_index);                            \
 		if (udata)                                                                          \
 			return *udata;                                                                  \
                                                                                             \
-		return m_type(lua_tostring(L, p_index));                                            \
+		return luaGD_tostr##m_type(L, p_index);                                             \
 	}                                                                                       \
                                                                                             \
 	UDATA_CHECK_PTR(m_type, BUILTIN_MT_NAME(m_type), m_tag)                                 \
                                                                                             \
 	m_type LuaStackOp<m_type>::check(lua_State *L, int p_index) {                           \
 		if (lua_isstring(L, p_index))                                                       \
-			return m_type(lua_tostring(L, p_index));                                        \
+			return luaGD_tostr##m_type(L, p_index);                                         \
                                                                                             \
 		m_type *udata = LuaStackOp<m_type>::get_ptr(L, p_index);                            \
 		if (udata)                                                                          \
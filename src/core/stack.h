@@ -4,7 +4,10 @@
 #include <lua.h>
 #include <lualib.h>
 #include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/node_path.hpp>
 #include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
 using namespace godot;
@@ -104,6 +107,26 @@ struct LuaStackOp<Variant> {
 STACK_OP_STR_DEF(StringName)
 STACK_OP_STR_DEF(NodePath)
 
+#define STRING_ATOM_SEEN_SIZE 256
+
+// StringName/NodePath conversions of a VM's strings, indexed by string atom. Owned by the VM.
+struct GDStringAtoms {
+	struct Entry {
+		StringName string_name;
+
+		// NodePath parses its input and may print errors, so only create it if needed
+		bool has_node_path = false;
+		NodePath node_path;
+	};
+
+	LocalVector<Entry> entries;
+	// Strings converted once, by address
+	const char *seen[STRING_ATOM_SEEN_SIZE] = {};
+};
+
+// Caches StringName/NodePath conversions of Luau strings. Set as the `useratom` callback of each VM.
+int16_t luaGD_useratom(const char *p_str, size_t p_len);
+
 /* USERDATA */
 
 #define UDATA_ALLOC(m_type, m_tag, m_dtor)                                                                        \
@@ -4,11 +4,13 @@
 #include <lua.h>
 #include <lualib.h>
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
 #include <godot_cpp/core/memory.hpp>
 #include <godot_cpp/godot.hpp>
 #include <godot_cpp/variant/builtin_types.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
+#include "core/lua_utils.h"
 #include "core/stack.h"
 #include "utils/wrapped_no_binding.h"
 
@@ -349,6 +351,124 @@ void LuauVariant::lua_push(lua_State *L) const {
 	type_methods[type]->push(*this, L);
 }
 
+LuauArrayType LuauArrayType::from_type_name(const String &p_type_name) {
+	LuauArrayType array_type;
+
+	// Bindgen writes "Array" for untyped arrays
+	if (p_type_name.is_empty() || p_type_name == "Array" || p_type_name == "Variant")
+		return array_type;
+
+	for (int i = GDEXTENSION_VARIANT_TYPE_BOOL; i < GDEXTENSION_VARIANT_TYPE_VARIANT_MAX; i++) {
+		if (i != GDEXTENSION_VARIANT_TYPE_OBJECT && p_type_name == Variant::get_type_name(Variant::Type(i))) {
+			array_type.type = i;
+			return array_type;
+		}
+	}
+
+	array_type.type = GDEXTENSION_VARIANT_TYPE_OBJECT;
+	array_type.class_name = p_type_name;
+
+	return array_type;
+}
+
+static void luaGD_array_elementerror(lua_State *L, int p_elem, const LuauArrayType &p_array_type) {
+	String type_name = p_array_type.type == GDEXTENSION_VARIANT_TYPE_OBJECT
+			? String(p_array_type.class_name)
+			: Variant::get_type_name(Variant::Type(p_array_type.type));
+
+	luaL_error(L, "invalid array element #%d (%s expected, got %s)", p_elem, type_name.utf8().get_data(), luaL_typename(L, -1));
+}
+
+void LuauVariant::lua_check_array(lua_State *L, int p_idx, const LuauArrayType &p_array_type) {
+	if (!lua_istable(L, p_idx)) {
+		lua_check(L, p_idx, GDEXTENSION_VARIANT_TYPE_ARRAY);
+		return;
+	}
+
+	p_idx = lua_absindex(L, p_idx);
+
+	initialize(GDEXTENSION_VARIANT_TYPE_ARRAY);
+	from_luau = false;
+
+	Array &array = *get_ptr<Array>();
+	int size = lua_objlen(L, p_idx);
+
+	if (p_array_type.is_typed()) {
+		array.set_typed(p_array_type.type, p_array_type.class_name, Variant());
+	}
+
+	array.resize(size);
+	if (size == 0)
+		return;
+
+	// Array storage is contiguous; write elements directly instead of going through the indexer for each one.
+	Variant *elems = &array[0];
+	LuauVariant elem;
+
+	for (int i = 0; i < size; i++) {
+		lua_rawgeti(L, p_idx, i + 1);
+
+		switch (p_array_type.type) {
+			case -1:
+				elems[i] = LuaStackOp<Variant>::check(L, -1);
+				break;
+
+			case GDEXTENSION_VARIANT_TYPE_BOOL:
+				if (!lua_isboolean(L, -1))
+					luaGD_array_elementerror(L, i + 1, p_array_type);
+
+				elems[i] = bool(lua_toboolean(L, -1));
+				break;
+
+			case GDEXTENSION_VARIANT_TYPE_INT:
+				// Only integral numbers; lua_isnumber would also accept numeric strings
+				if (lua_type(L, -1) == LUA_TNUMBER) {
+					double num = lua_tonumber(L, -1);
+					if (num != Math::floor(num))
+						luaGD_array_elementerror(L, i + 1, p_array_type);
+
+					elems[i] = int64_t(num);
+				} else if (int64_t *udata = reinterpret_cast<int64_t *>(lua_touserdatatagged(L, -1, UDATA_TAG_INT64))) {
+					elems[i] = *udata;
+				} else {
+					luaGD_array_elementerror(L, i + 1, p_array_type);
+				}
+
+				break;
+
+			case GDEXTENSION_VARIANT_TYPE_FLOAT:
+				if (!lua_isnumber(L, -1))
+					luaGD_array_elementerror(L, i + 1, p_array_type);
+
+				elems[i] = lua_tonumber(L, -1);
+				break;
+
+			case GDEXTENSION_VARIANT_TYPE_OBJECT: {
+				if (!LuaStackOp<Object *>::is(L, -1))
+					luaGD_array_elementerror(L, i + 1, p_array_type);
+
+				GDExtensionObjectPtr obj = LuaStackOp<Object *>::get(L, -1);
+				if (obj && !p_array_type.class_name.is_empty() && !nb::Object(obj).is_class(p_array_type.class_name))
+					luaGD_array_elementerror(L, i + 1, p_array_type);
+
+				elem.lua_check(L, -1, GDEXTENSION_VARIANT_TYPE_OBJECT);
+				elems[i] = elem.to_variant();
+				break;
+			}
+
+			default:
+				if (!type_methods[p_array_type.type]->is(L, -1, String()))
+					luaGD_array_elementerror(L, i + 1, p_array_type);
+
+				elem.lua_check(L, -1, GDExtensionVariantType(p_array_type.type));
+				elems[i] = elem.to_variant();
+				break;
+		}
+
+		lua_pop(L, 1); // value
+	}
+}
+
 void LuauVariant::assign_variant(const Variant &p_val) {
 	if (type == -1)
 		return;
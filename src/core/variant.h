@@ -3,6 +3,7 @@
 #include <gdextension_interface.h>
 #include <godot_cpp/core/defs.hpp>
 #include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
 
 using namespace godot;
 
@@ -10,6 +11,16 @@ struct lua_State;
 
 #define DATA_SIZE sizeof(real_t) * 4
 
+// Element type of a typed Array. Resolved once so that conversions don't need to look at names.
+struct LuauArrayType {
+	int32_t type = -1; // GDExtensionVariantType or -1 if untyped
+	StringName class_name; // if OBJECT
+
+	_FORCE_INLINE_ bool is_typed() const { return type != -1; }
+
+	static LuauArrayType from_type_name(const String &p_type_name);
+};
+
 // Mirrors Variant + VariantInternal.
 class LuauVariant {
 	int32_t type;
@@ -60,6 +71,9 @@ public:
 			const String &p_type_name = "");
 	void lua_push(lua_State *L) const;
 
+	// Accepts an Array userdata or a table. Tables are converted in bulk to an Array of the given element type.
+	void lua_check_array(lua_State *L, int p_idx, const LuauArrayType &p_array_type);
+
 	/* To/from Variant */
 	void assign_variant(const Variant &p_val);
 	Variant to_variant();
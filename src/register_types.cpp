@@ -2,6 +2,7 @@
 
 #include <Luau/Common.h>
 #include <gdextension_interface.h>
+#include <godot_cpp/classes/editor_plugin_registration.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/ref.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
@@ -14,6 +15,7 @@
 
 #include "core/variant.h"
 #include "scheduler/wait_signal_task.h"
+#include "scripting/luau_export_plugin.h"
 #include "scripting/luau_script.h"
 #include "scripting/resource_format_luau_script.h"
 #include "utils/wrapped_no_binding.h"
@@ -25,6 +27,16 @@ Ref<ResourceFormatLoaderLuauScript> resource_loader_luau;
 Ref<ResourceFormatSaverLuauScript> resource_saver_luau;
 
 void initialize_luau_script_module(ModuleInitializationLevel p_level) {
+#ifdef TOOLS_ENABLED
+	if (p_level == MODULE_INITIALIZATION_LEVEL_EDITOR) {
+		GDREGISTER_INTERNAL_CLASS(LuauExportPlugin);
+		GDREGISTER_INTERNAL_CLASS(LuauEditorPlugin);
+		EditorPlugins::add_by_type<LuauEditorPlugin>();
+
+		return;
+	}
+#endif // TOOLS_ENABLED
+
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE)
 		return;
 
@@ -41,6 +53,7 @@ void initialize_luau_script_module(ModuleInitializationLevel p_level) {
 
 	GDREGISTER_CLASS(LuauScript);
 	GDREGISTER_CLASS(LuauLanguage);
+	GDREGISTER_INTERNAL_CLASS(LuauProcessGroupRunner);
 
 	script_language_luau = memnew(LuauLanguage);
 	CRASH_COND_MSG(nb::Engine::get_singleton_nb()->register_script_language(script_language_luau) != OK, "Failed to register LuauLanguage");
@@ -57,6 +70,13 @@ void initialize_luau_script_module(ModuleInitializationLevel p_level) {
 }
 
 void uninitialize_luau_script_module(ModuleInitializationLevel p_level) {
+#ifdef TOOLS_ENABLED
+	if (p_level == MODULE_INITIALIZATION_LEVEL_EDITOR) {
+		EditorPlugins::remove_by_type<LuauEditorPlugin>();
+		return;
+	}
+#endif // TOOLS_ENABLED
+
 	if (p_level != MODULE_INITIALIZATION_LEVEL_SCENE)
 		return;
 
@@ -1,57 +1,330 @@
 #include "scripting/luau_cache.h"
 
+#include <Luau/Bytecode.h>
+#include <Luau/Compiler.h>
+#include <cstring>
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/global_constants.hpp>
 #include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/classes/worker_thread_pool.hpp>
+#include <godot_cpp/core/mutex_lock.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
 
+#include "analysis/analysis.h"
+#include "core/lua_utils.h"
+#include "scripting/luau_lib.h"
 #include "scripting/luau_script.h"
+#include "scripting/resource_format_luau_script.h"
+#include "utils/utils.h"
+#include "utils/wrapped_no_binding.h"
 
 using namespace godot;
 
 LuauCache *LuauCache::singleton = nullptr;
 
-Ref<LuauScript> LuauCache::get_script(const String &p_path, Error &r_error, bool p_ignore_cache, LuauScript::LoadStage p_stage) {
+static bool is_main_thread() {
+	nb::OS *os = nb::OS::get_singleton_nb();
+	return os->get_thread_caller_id() == os->get_main_thread_id();
+}
+
+// Compiled scripts are cached under their source path, which is what requires and base scripts refer to.
+static String resolve_script_path(const String &p_path) {
 	String path = p_path.simplify_path();
 
+	if (path.get_extension() == "luauc")
+		path = path.get_basename() + ".lua";
+
+	return path;
+}
+
+Ref<LuauScript> LuauCache::get_script(const String &p_path, Error &r_error, bool p_ignore_cache, LuauScript::LoadStage p_stage) {
+	String path = resolve_script_path(p_path);
+
 	Ref<LuauScript> script;
 	r_error = OK;
 
-	HashMap<String, Ref<LuauScript>>::ConstIterator E = cache.find(path);
-	if (E) {
-		script = E->value;
+	bool needs_init = false;
+
+	// The VM stage is kept on the main thread where possible.
+	// Loader threads stop after analysis and the rest is done in finish_pending_loads or on first instantiation.
+	bool defer = p_stage == LuauScript::LOAD_FULL && !is_main_thread();
+	LuauScript::LoadStage stage = defer ? LuauScript::LOAD_ANALYZE : p_stage;
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+
+		HashMap<String, Ref<LuauScript>>::ConstIterator E = cache.find(path);
+
+		if (E) {
+			script = E->value;
+		} else {
+			needs_init = true;
+			script.instantiate();
+
+			// This is done for tests, as Godot is holding onto references to scripts for some reason.
+			// Shouldn't really have side effects, hopefully.
+			script->take_over_path(path);
 
-		if (!p_ignore_cache) {
-			script->load(p_stage);
-			return script;
+			// Other threads can find the script as soon as it is cached, so they must wait for the first load.
+			// Nobody else can hold this lock yet, so taking it under `lock` cannot block.
+			script->load_lock->lock();
+
+			// Set cache before `load` to prevent infinite recursion inside.
+			cache[path] = script;
+
+			r_error = script->load_source_code(path);
+
+			if (path.ends_with(".mod.lua")) {
+				script->_is_module = true;
+			}
 		}
 	}
 
-	bool needs_init = script.is_null();
-
 	if (needs_init) {
-		script.instantiate();
+		if (r_error == OK)
+			r_error = script->load(stage, true);
+
+		script->load_lock->unlock();
+	} else if (!p_ignore_cache) {
+		r_error = script->load(stage);
+	} else {
+		MutexLock load_lock(*script->load_lock.ptr());
+
+		r_error = script->load_source_code(path);
+
+		if (r_error == OK)
+			r_error = script->load(stage, true);
+	}
 
-		// This is done for tests, as Godot is holding onto references to scripts for some reason.
-		// Shouldn't really have side effects, hopefully.
-		script->take_over_path(path);
+	if (r_error != OK)
+		return script;
 
-		// Set cache before `load` to prevent infinite recursion inside.
-		cache[path] = script;
+	if (defer && script->get_load_stage() != LuauScript::LOAD_FULL) {
+		std::lock_guard<std::mutex> guard(lock);
+		pending_loads.push_back(script);
 	}
 
-	if (p_ignore_cache || needs_init) {
-		r_error = script->load_source_code(path);
+	return script;
+}
 
-		if (r_error != OK)
-			return script;
+void LuauCache::finish_pending_loads() {
+	LocalVector<Ref<LuauScript>> to_load;
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+
+		if (pending_loads.is_empty())
+			return;
+
+		to_load = pending_loads;
+		pending_loads.clear();
 	}
 
-	if (path.ends_with(".mod.lua")) {
-		script->_is_module = true;
+	for (Ref<LuauScript> &script : to_load) {
+		if (script->_is_valid())
+			script->load(LuauScript::LOAD_FULL);
 	}
+}
 
-	script->load(p_stage, true);
+#ifdef TOOLS_ENABLED
+bool LuauCache::get_class_header(const String &p_path, LuauClassHeader &r_header) {
+	String path = resolve_script_path(p_path);
+	uint64_t modified_time = FileAccess::get_modified_time(path);
 
-	return script;
+	{
+		std::lock_guard<std::mutex> guard(lock);
+
+		HashMap<String, ClassHeaderEntry>::ConstIterator E = class_headers.find(path);
+
+		if (E && E->value.modified_time == modified_time) {
+			r_header = E->value.header;
+			return E->value.has_class;
+		}
+	}
+
+	CharString src;
+	if (Utils::load_file(path, src) != OK)
+		return false;
+
+	ClassHeaderEntry entry;
+	entry.modified_time = modified_time;
+	entry.has_class = luascript_scan_class_header(path, src.get_data(), entry.header);
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		class_headers[path] = entry;
+	}
+
+	r_header = entry.header;
+	return entry.has_class;
+}
+#endif // TOOLS_ENABLED
+
+void LuauCache::compile_task(uint32_t p_index, const Array &p_scripts) {
+	Ref<LuauScript> script = p_scripts[p_index];
+
+	// Parsing and compilation only touch the script itself
+	script->load(LuauScript::LOAD_COMPILE, true);
+}
+
+void LuauCache::preload_scripts(const PackedStringArray &p_paths) {
+	Array scripts;
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+
+		for (const String &script_path : p_paths) {
+			String path = resolve_script_path(script_path);
+
+			if (cache.has(path))
+				continue;
+
+			Ref<LuauScript> script;
+			script.instantiate();
+
+			if (script->load_source_code(path) != OK)
+				continue;
+
+			script->take_over_path(path);
+
+			if (path.ends_with(".mod.lua")) {
+				script->_is_module = true;
+			}
+
+			cache[path] = script;
+			scripts.push_back(script);
+		}
+	}
+
+	if (scripts.is_empty())
+		return;
+
+	// Initialized lazily; do it here rather than racing on the worker threads
+	luaGD_compileopts();
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	int64_t group_id = pool->add_group_task(callable_mp_static(&LuauCache::compile_task).bind(scripts), scripts.size(), -1, true, "Compile Luau scripts");
+	pool->wait_for_group_task_completion(group_id);
+
+	// Analysis resolves base scripts and requires through the cache, so it stays on this thread.
+	for (int i = 0; i < scripts.size(); i++) {
+		Ref<LuauScript> script = scripts[i];
+		script->load(LuauScript::LOAD_ANALYZE);
+	}
+}
+
+void LuauCache::discover_scripts(const String &p_path, const PackedStringArray &p_exclude, PackedStringArray &r_paths) {
+	if (p_path == "res://.godot" || p_exclude.has(p_path) || p_exclude.has(p_path + "/"))
+		return;
+
+	Ref<DirAccess> dir = DirAccess::open(p_path);
+	ERR_FAIL_COND_MSG(!dir.is_valid(), "Failed to open directory at " + p_path);
+
+	Error err = dir->list_dir_begin();
+	ERR_FAIL_COND_MSG(err != OK, "Failed to list directory at " + p_path);
+
+	String file_name = dir->get_next();
+
+	while (!file_name.is_empty()) {
+		String file_name_full = p_path.path_join(file_name);
+
+		if (dir->current_is_dir()) {
+			discover_scripts(file_name_full, p_exclude, r_paths);
+		} else if (ResourceFormatLoaderLuauScript::get_resource_type(file_name_full) == LuauLanguage::get_singleton()->_get_type()) {
+			r_paths.push_back(file_name_full);
+		}
+
+		file_name = dir->get_next();
+	}
+}
+
+#define PRELOAD_ENABLED_SETTING "luau_script/preload/enabled"
+#define PRELOAD_EXCLUDE_SETTING "luau_script/preload/exclude_paths"
+
+static Variant preload_setting(const String &p_name, const Variant &p_default) {
+	nb::ProjectSettings *settings = nb::ProjectSettings::get_singleton_nb();
+
+	if (!settings->has_setting(p_name))
+		settings->set_setting(p_name, p_default);
+
+	settings->set_initial_value(p_name, p_default);
+	return settings->get_setting(p_name);
+}
+
+void LuauCache::preload_project_scripts() {
+	if (!preload_setting(PRELOAD_ENABLED_SETTING, true))
+		return;
+
+	PackedStringArray default_exclude;
+	default_exclude.push_back("res://addons");
+	default_exclude.push_back("res://tests");
+
+	PackedStringArray exclude = preload_setting(PRELOAD_EXCLUDE_SETTING, default_exclude);
+
+	PackedStringArray paths;
+	discover_scripts("res://", exclude, paths);
+
+	UtilityFunctions::print_verbose("Preloading ", paths.size(), " Luau scripts...");
+	preload_scripts(paths);
+}
+
+// Bump when the disk cache layout changes
+#define DISK_CACHE_VERSION 1
+
+// Set by SConstruct. Without it, fall back to the time this file was built.
+#ifndef LUAU_SCRIPT_BUILD_ID
+#define LUAU_SCRIPT_BUILD_ID __DATE__ " " __TIME__
+#endif
+
+static uint64_t hash_value(uint64_t p_hash, int64_t p_value) {
+	return Utils::hash64(&p_value, sizeof(p_value), p_hash);
+}
+
+static uint64_t hash_string(uint64_t p_hash, const char *p_str) {
+	return Utils::hash64(p_str, strlen(p_str) + 1, p_hash);
+}
+
+void LuauCache::set_disk_cache_enabled(bool p_enabled) {
+	disk_cache_enabled = p_enabled;
+
+	if (!p_enabled)
+		return;
+
+	const Luau::CompileOptions &opts = luaGD_compileopts();
+
+	uint64_t hash = Utils::hash64(nullptr, 0);
+	hash = hash_value(hash, DISK_CACHE_VERSION);
+	// Analysis and bindings can change between builds without any of the versions below changing
+	hash = hash_string(hash, LUAU_SCRIPT_BUILD_ID);
+	hash = hash_value(hash, LUAU_DEFINITION_FORMAT);
+	hash = hash_value(hash, LBC_VERSION_TARGET);
+	hash = hash_value(hash, opts.optimizationLevel);
+	hash = hash_value(hash, opts.debugLevel);
+	hash = hash_value(hash, opts.coverageLevel);
+
+	for (const char *const *global = opts.mutableGlobals; global && *global; global++)
+		hash = hash_string(hash, *global);
+
+	// Definitions depend on the engine's class list
+	String godot_version = nb::Engine::get_singleton_nb()->get_version_info()["string"];
+	hash = hash_string(hash, godot_version.utf8().get_data());
+
+	disk_cache_env_hash = hash;
+
+	DirAccess::make_dir_recursive_absolute(disk_cache_dir);
+}
+
+void LuauCache::set_disk_cache_dir(const String &p_dir) {
+	disk_cache_dir = p_dir;
+
+	if (disk_cache_enabled)
+		DirAccess::make_dir_recursive_absolute(disk_cache_dir);
+}
+
+String LuauCache::get_disk_cache_path(const String &p_script_path) const {
+	return disk_cache_dir.path_join(p_script_path.md5_text() + ".bin");
 }
 
 LuauCache::LuauCache() {
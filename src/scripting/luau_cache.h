@@ -2,23 +2,83 @@
 
 #include <godot_cpp/classes/ref.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
 #include <godot_cpp/variant/string.hpp>
+#include <cstdint>
+#include <mutex>
 
+#include "analysis/analysis.h"
 #include "scripting/luau_script.h"
 
 using namespace godot;
 
+#define LUAU_DISK_CACHE_DIR "res://.godot/luau_cache"
+
 // Based on GDScriptCache
 class LuauCache {
+	// Guards the maps only. Loading is serialized per script (LuauScript::load_lock) so different scripts can load in parallel.
+	std::mutex lock;
 	HashMap<String, Ref<LuauScript>> cache;
+	LocalVector<Ref<LuauScript>> pending_loads; // Loaded off the main thread, waiting for LOAD_FULL
+
+	// Compiled bytecode and class definitions, keyed by source (see LuauScript::load_disk_cache)
+	bool disk_cache_enabled = false;
+	uint64_t disk_cache_env_hash = 0;
+	String disk_cache_dir = LUAU_DISK_CACHE_DIR;
+
+	bool lean_mode = false;
+
+#ifdef TOOLS_ENABLED
+	struct ClassHeaderEntry {
+		uint64_t modified_time = 0;
+		bool has_class = false;
+		LuauClassHeader header;
+	};
+
+	HashMap<String, ClassHeaderEntry> class_headers; // Guarded by lock
+#endif // TOOLS_ENABLED
 
 	static LuauCache *singleton;
 
+	static void compile_task(uint32_t p_index, const Array &p_scripts);
+	static void discover_scripts(const String &p_path, const PackedStringArray &p_exclude, PackedStringArray &r_paths);
+
 public:
 	static LuauCache *get_singleton() { return singleton; }
 
 	Ref<LuauScript> get_script(const String &p_path, Error &r_error, bool p_ignore_cache = false, LuauScript::LoadStage p_stage = LuauScript::LOAD_FULL);
 
+	// Compiles the given scripts on the WorkerThreadPool, then analyzes them.
+	// Table loading (LOAD_FULL) touches the VMs and is still done on first use.
+	void preload_scripts(const PackedStringArray &p_paths);
+	// Preloads every script in the project, according to the luau_script/preload/* project settings.
+	void preload_project_scripts();
+
+	// Off by default, so that tests and tools see freshly analyzed scripts.
+	void set_disk_cache_enabled(bool p_enabled);
+	bool is_disk_cache_enabled() const { return disk_cache_enabled; }
+	// Changes whenever bytecode or definitions produced from the same source could differ
+	uint64_t get_disk_cache_env_hash() const { return disk_cache_env_hash; }
+	void set_disk_cache_dir(const String &p_dir);
+	const String &get_disk_cache_dir() const { return disk_cache_dir; }
+	String get_disk_cache_path(const String &p_script_path) const;
+
+	// Frees source and syntax trees once scripts are loaded, re-reading them from disk when needed.
+	// Bytecode is only freed for compiled scripts, which can read it back from the .luauc file.
+	// Enabled outside the editor, where scripts can't change.
+	void set_lean_mode(bool p_enabled) { lean_mode = p_enabled; }
+	bool is_lean_mode() const { return lean_mode; }
+
+#ifdef TOOLS_ENABLED
+	// Scans the source for the class name, base and icon without loading the script. Cached by modification time.
+	bool get_class_header(const String &p_path, LuauClassHeader &r_header);
+#endif // TOOLS_ENABLED
+
+	// Runs the VM stage for scripts loaded on other threads. Main thread only.
+	void finish_pending_loads();
+
 	LuauCache();
 	~LuauCache();
 };
@@ -0,0 +1,85 @@
+#include "scripting/luau_export_plugin.h"
+
+#ifdef TOOLS_ENABLED
+
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include "scripting/luau_cache.h"
+#include "scripting/luau_script.h"
+#include "scripting/resource_format_luau_script.h"
+
+using namespace godot;
+
+#define OPTION_COMPILE "luau/compile_scripts"
+#define OPTION_STRIP_DEBUG_INFO "luau/strip_debug_info"
+
+static Dictionary make_bool_option(const String &p_name, bool p_default) {
+	Dictionary property;
+	property["name"] = p_name;
+	property["type"] = Variant::BOOL;
+
+	Dictionary option;
+	option["option"] = property;
+	option["default_value"] = p_default;
+
+	return option;
+}
+
+String LuauExportPlugin::_get_name() const {
+	return "LuauScript";
+}
+
+bool LuauExportPlugin::_supports_platform(const Ref<EditorExportPlatform> &p_platform) const {
+	return true;
+}
+
+TypedArray<Dictionary> LuauExportPlugin::_get_export_options(const Ref<EditorExportPlatform> &p_platform) const {
+	TypedArray<Dictionary> options;
+	options.push_back(make_bool_option(OPTION_COMPILE, true));
+	options.push_back(make_bool_option(OPTION_STRIP_DEBUG_INFO, false));
+
+	return options;
+}
+
+void LuauExportPlugin::_export_file(const String &p_path, const String &p_type, const PackedStringArray &p_features) {
+	if (!get_option(OPTION_COMPILE))
+		return;
+
+	// init.lua is always read as source
+	if (ResourceFormatLoaderLuauScript::get_resource_type(p_path) != LuauLanguage::get_singleton()->_get_type())
+		return;
+
+	Error err = OK;
+	Ref<LuauScript> script = LuauCache::get_singleton()->get_script(p_path, err, false, LuauScript::LOAD_ANALYZE);
+	ERR_FAIL_COND_MSG(err != OK || !script->_is_valid(), "Failed to load script at " + p_path + "; exporting source");
+
+	PackedByteArray data;
+	err = script->export_compiled(get_option(OPTION_STRIP_DEBUG_INFO), data);
+	ERR_FAIL_COND_MSG(err != OK, "Failed to compile script at " + p_path + "; exporting source");
+
+	// Remapped, so that loading the .lua path finds the compiled script
+	add_file(p_path.get_basename() + ".luauc", data, true);
+	skip();
+}
+
+void LuauEditorPlugin::_notification(int p_what) {
+	switch (p_what) {
+		case Node::NOTIFICATION_ENTER_TREE:
+			export_plugin.instantiate();
+			add_export_plugin(export_plugin);
+			break;
+
+		case Node::NOTIFICATION_EXIT_TREE:
+			remove_export_plugin(export_plugin);
+			export_plugin.unref();
+			break;
+
+		default:
+			break;
+	}
+}
+
+#endif // TOOLS_ENABLED
@@ -0,0 +1,40 @@
+#pragma once
+
+#ifdef TOOLS_ENABLED
+
+#include <godot_cpp/classes/editor_export_platform.hpp>
+#include <godot_cpp/classes/editor_export_plugin.hpp>
+#include <godot_cpp/classes/editor_plugin.hpp>
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+using namespace godot;
+
+// Replaces Luau scripts with compiled scripts (.luauc) on export, so that exported projects don't parse or compile anything.
+class LuauExportPlugin : public EditorExportPlugin {
+	GDCLASS(LuauExportPlugin, EditorExportPlugin);
+
+protected:
+	static void _bind_methods() {}
+
+public:
+	String _get_name() const override;
+	bool _supports_platform(const Ref<EditorExportPlatform> &p_platform) const override;
+	TypedArray<Dictionary> _get_export_options(const Ref<EditorExportPlatform> &p_platform) const override;
+	void _export_file(const String &p_path, const String &p_type, const PackedStringArray &p_features) override;
+};
+
+class LuauEditorPlugin : public EditorPlugin {
+	GDCLASS(LuauEditorPlugin, EditorPlugin);
+
+	Ref<LuauExportPlugin> export_plugin;
+
+protected:
+	static void _bind_methods() {}
+	void _notification(int p_what);
+};
+
+#endif // TOOLS_ENABLED
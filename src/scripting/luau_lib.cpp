@@ -8,6 +8,8 @@
 #include <godot_cpp/classes/ref.hpp>
 #include <godot_cpp/core/defs.hpp>
 #include <godot_cpp/core/object.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/array.hpp>
 #include <godot_cpp/variant/builtin_types.hpp>
 #include <godot_cpp/variant/char_string.hpp>
 #include <godot_cpp/variant/variant.hpp>
@@ -98,6 +100,220 @@ int GDClassDefinition::set_prop(const String &p_name, const GDClassProperty &p_p
 	}
 }
 
+/* CACHE SERIALIZATION */
+
+// Compact positional encoding for the disk cache and compiled scripts.
+// Bump LUAU_DEFINITION_FORMAT (luau_lib.h) whenever the layout changes.
+
+static Array serialize_property(const GDProperty &p_prop) {
+	Array arr;
+	arr.resize(8);
+
+	arr[0] = p_prop.type;
+	arr[1] = int64_t(p_prop.usage);
+	arr[2] = p_prop.name;
+	arr[3] = p_prop.class_name;
+	arr[4] = p_prop.hint;
+	arr[5] = p_prop.hint_string;
+	arr[6] = p_prop.array_type.type;
+	arr[7] = p_prop.array_type.class_name;
+
+	return arr;
+}
+
+static bool deserialize_property(const Array &p_arr, GDProperty &r_prop) {
+	if (p_arr.size() != 8)
+		return false;
+
+	r_prop.type = GDExtensionVariantType(int(p_arr[0]));
+	r_prop.usage = BitField<PropertyUsageFlags>(int64_t(p_arr[1]));
+	r_prop.name = p_arr[2];
+	r_prop.class_name = p_arr[3];
+	r_prop.hint = PropertyHint(int(p_arr[4]));
+	r_prop.hint_string = p_arr[5];
+	r_prop.array_type.type = p_arr[6];
+	r_prop.array_type.class_name = p_arr[7];
+
+	return true;
+}
+
+static Array serialize_method(const GDMethod &p_method) {
+	Array args;
+	for (const GDProperty &arg : p_method.arguments)
+		args.push_back(serialize_property(arg));
+
+	Array default_args;
+	for (const Variant &default_arg : p_method.default_arguments)
+		default_args.push_back(default_arg);
+
+	Array arr;
+	arr.resize(5);
+
+	arr[0] = p_method.name;
+	arr[1] = serialize_property(p_method.return_val);
+	arr[2] = int64_t(p_method.flags);
+	arr[3] = args;
+	arr[4] = default_args;
+
+	return arr;
+}
+
+static bool deserialize_method(const Array &p_arr, GDMethod &r_method) {
+	if (p_arr.size() != 5 || !deserialize_property(p_arr[1], r_method.return_val))
+		return false;
+
+	r_method.name = p_arr[0];
+	r_method.flags = BitField<MethodFlags>(int64_t(p_arr[2]));
+
+	Array args = p_arr[3];
+	r_method.arguments.resize(args.size());
+
+	for (int i = 0; i < args.size(); i++) {
+		if (!deserialize_property(args[i], r_method.arguments.write[i]))
+			return false;
+	}
+
+	Array default_args = p_arr[4];
+	r_method.default_arguments.resize(default_args.size());
+
+	for (int i = 0; i < default_args.size(); i++)
+		r_method.default_arguments.write[i] = default_args[i];
+
+	return true;
+}
+
+static Dictionary serialize_methods(const HashMap<StringName, GDMethod> &p_methods) {
+	Dictionary dict;
+
+	for (const KeyValue<StringName, GDMethod> &E : p_methods)
+		dict[E.key] = serialize_method(E.value);
+
+	return dict;
+}
+
+static bool deserialize_methods(const Dictionary &p_dict, HashMap<StringName, GDMethod> &r_methods) {
+	Array keys = p_dict.keys();
+
+	for (int i = 0; i < keys.size(); i++) {
+		if (!deserialize_method(p_dict[keys[i]], r_methods[keys[i]]))
+			return false;
+	}
+
+	return true;
+}
+
+Array GDClassDefinition::serialize() const {
+	Array props;
+
+	for (const GDClassProperty &prop : properties) {
+		Array arr;
+		arr.resize(4);
+
+		arr[0] = serialize_property(prop.property);
+		arr[1] = prop.getter;
+		arr[2] = prop.setter;
+		arr[3] = prop.default_value;
+
+		props.push_back(arr);
+	}
+
+	Dictionary rpcs_dict;
+
+	for (const KeyValue<StringName, GDRpc> &E : rpcs) {
+		Array arr;
+		arr.resize(5);
+
+		arr[0] = E.value.name;
+		arr[1] = E.value.rpc_mode;
+		arr[2] = E.value.transfer_mode;
+		arr[3] = E.value.call_local;
+		arr[4] = E.value.channel;
+
+		rpcs_dict[E.key] = arr;
+	}
+
+	Dictionary constants_dict;
+
+	for (const KeyValue<StringName, int> &E : constants)
+		constants_dict[E.key] = E.value;
+
+	Array arr;
+	arr.resize(12);
+
+	arr[0] = LUAU_DEFINITION_FORMAT;
+	arr[1] = name;
+	arr[2] = extends;
+	arr[3] = icon_path;
+	arr[4] = permissions;
+	arr[5] = is_tool;
+	arr[6] = process_group;
+	arr[7] = serialize_methods(methods);
+	arr[8] = props;
+	arr[9] = serialize_methods(signals);
+	arr[10] = rpcs_dict;
+	arr[11] = constants_dict;
+
+	return arr;
+}
+
+bool GDClassDefinition::deserialize(const Array &p_data, GDClassDefinition &r_def) {
+	if (p_data.size() != 12 || int(p_data[0]) != LUAU_DEFINITION_FORMAT)
+		return false;
+
+	GDClassDefinition def;
+
+	def.name = p_data[1];
+	def.extends = p_data[2];
+	def.icon_path = p_data[3];
+	def.permissions = ThreadPermissions(int(p_data[4]));
+	def.is_tool = p_data[5];
+	def.process_group = p_data[6];
+
+	if (!deserialize_methods(p_data[7], def.methods) || !deserialize_methods(p_data[9], def.signals))
+		return false;
+
+	Array props = p_data[8];
+
+	for (int i = 0; i < props.size(); i++) {
+		Array arr = props[i];
+		GDClassProperty prop;
+
+		if (arr.size() != 4 || !deserialize_property(arr[0], prop.property))
+			return false;
+
+		prop.getter = arr[1];
+		prop.setter = arr[2];
+		prop.default_value = arr[3];
+
+		def.set_prop(prop.property.name, prop);
+	}
+
+	Dictionary rpcs_dict = p_data[10];
+	Array rpc_keys = rpcs_dict.keys();
+
+	for (int i = 0; i < rpc_keys.size(); i++) {
+		Array arr = rpcs_dict[rpc_keys[i]];
+		if (arr.size() != 5)
+			return false;
+
+		GDRpc &rpc = def.rpcs[rpc_keys[i]];
+		rpc.name = arr[0];
+		rpc.rpc_mode = MultiplayerAPI::RPCMode(int(arr[1]));
+		rpc.transfer_mode = MultiplayerPeer::TransferMode(int(arr[2]));
+		rpc.call_local = arr[3];
+		rpc.channel = arr[4];
+	}
+
+	Dictionary constants_dict = p_data[11];
+	Array constant_keys = constants_dict.keys();
+
+	for (int i = 0; i < constant_keys.size(); i++)
+		def.constants[constant_keys[i]] = int(constants_dict[constant_keys[i]]);
+
+	r_def = def;
+	return true;
+}
+
 /* PROPERTY */
 
 GDProperty luascript_read_property(lua_State *L, int p_idx) {
@@ -230,7 +446,8 @@ static int luascript_require(lua_State *L) {
 	if (udata->script->get_path() == full_path)
 		luaL_error(L, "scripts cannot require themselves");
 
-	if (FileAccess::file_exists(full_path + ".lua")) {
+	// Exported projects only have the compiled script, which is still loaded from the .lua path (see LuauScript::load_source_code)
+	if (FileAccess::file_exists(full_path + ".lua") || FileAccess::file_exists(full_path + ".luauc")) {
 		full_path = full_path + ".lua";
 	} else {
 		luaL_error(L, "could not find module: %s", path.utf8().get_data());
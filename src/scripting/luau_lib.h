@@ -9,12 +9,14 @@
 #include <godot_cpp/core/type_info.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/vector.hpp>
+#include <godot_cpp/variant/array.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/string_name.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
 #include "core/permissions.h"
+#include "core/variant.h"
 #include "utils/utils.h"
 #include "utils/wrapped_no_binding.h"
 
@@ -23,6 +25,9 @@ using namespace godot;
 #define LUASCRIPT_MODULE_TABLE "_MODULES"
 #define LUASCRIPT_MT_SCRIPT "__script"
 
+// Version of the GDClassDefinition::serialize layout
+#define LUAU_DEFINITION_FORMAT 1
+
 struct GDProperty {
 	GDExtensionVariantType type = GDEXTENSION_VARIANT_TYPE_NIL;
 	BitField<PropertyUsageFlags> usage = PROPERTY_USAGE_DEFAULT;
@@ -33,6 +38,8 @@ struct GDProperty {
 	PropertyHint hint = PROPERTY_HINT_NONE;
 	String hint_string;
 
+	LuauArrayType array_type; // if ARRAY
+
 	operator Dictionary() const;
 	operator Variant() const;
 
@@ -66,13 +73,19 @@ struct GDProperty {
 			} else {
 				hint_string = p_type.class_name;
 			}
+
+			// Script classes are not known to ClassDB, so elements are only checked as Objects
+			array_type.type = GDEXTENSION_VARIANT_TYPE_OBJECT;
+			array_type.class_name = nb::ClassDB::get_singleton_nb()->class_exists(p_type.class_name) ? p_type.class_name : StringName("Object");
 		} else {
 			hint_string = Variant::get_type_name(Variant::Type(p_type.type));
+			array_type.type = p_type.type == GDEXTENSION_VARIANT_TYPE_NIL ? -1 : p_type.type;
 		}
 	}
 
 	GDExtensionVariantType get_arg_type() const { return type; }
 	const StringName &get_arg_type_name() const { return class_name; }
+	const LuauArrayType &get_arg_array_type() const { return array_type; }
 };
 
 struct GDClassProperty {
@@ -122,6 +135,7 @@ struct GDClassDefinition {
 	ThreadPermissions permissions = PERMISSION_BASE;
 
 	bool is_tool = false;
+	bool process_group = false;
 
 	HashMap<StringName, GDMethod> methods;
 	HashMap<StringName, uint64_t> property_indices;
@@ -131,6 +145,10 @@ struct GDClassDefinition {
 	HashMap<StringName, int> constants;
 
 	int set_prop(const String &p_name, const GDClassProperty &p_prop);
+
+	// Does not include base_script, which must be resolved by the caller.
+	Array serialize() const;
+	static bool deserialize(const Array &p_data, GDClassDefinition &r_def);
 };
 
 void luascript_get_classdef_or_type(lua_State *L, int p_index, String &r_type, LuauScript *&r_script);
@@ -1,5 +1,6 @@
 #include "scripting/luau_script.h"
 
+#include <Luau/Bytecode.h>
 #include <Luau/BytecodeBuilder.h>
 #include <Luau/CodeGen.h>
 #include <Luau/Compiler.h>
@@ -10,14 +11,20 @@
 #include <gdextension_interface.h>
 #include <lua.h>
 #include <lualib.h>
+#include <atomic>
 #include <cstring>
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/global_constants.hpp>
+#include <godot_cpp/classes/main_loop.hpp>
+#include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/object.hpp>
 #include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
 #include <godot_cpp/classes/script_language.hpp>
 #include <godot_cpp/classes/texture2d.hpp>
 #include <godot_cpp/classes/theme.hpp>
+#include <godot_cpp/classes/window.hpp>
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/core/memory.hpp>
 #include <godot_cpp/core/mutex_lock.hpp>
@@ -26,6 +33,7 @@
 #include <godot_cpp/templates/hash_set.hpp>
 #include <godot_cpp/templates/local_vector.hpp>
 #include <godot_cpp/templates/pair.hpp>
+#include <godot_cpp/variant/callable_method_pointer.hpp>
 #include <godot_cpp/variant/char_string.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/packed_string_array.hpp>
@@ -62,25 +70,52 @@ using namespace godot;
 ////////////
 
 bool LuauScript::_has_source_code() const {
-	return !source.is_empty();
+	return source.length() > 0 || (load_data_released && !is_compiled());
 }
 
 String LuauScript::_get_source_code() const {
-	return source;
+	if (load_data_released && !is_compiled()) {
+		CharString src;
+		if (Utils::load_file(get_path(), src) == OK)
+			return String::utf8(src.get_data(), src.length());
+	}
+
+	return String::utf8(source.get_data(), source.length());
 }
 
 void LuauScript::_set_source_code(const String &p_code) {
-	source = p_code;
+	load_data_released = false;
+	source = p_code.utf8();
+	source_hash = Utils::hash64(source.get_data(), source.length());
 	source_changed_cache = true;
 }
 
 Error LuauScript::load_source_code(const String &p_path) {
-	String src;
+	// Exported projects ship compiled scripts only
+	String compiled = p_path.get_basename() + ".luauc";
+
+	if (!FileAccess::file_exists(p_path) && FileAccess::file_exists(compiled)) {
+		load_data_released = false;
+		source = CharString();
+		source_hash = 0;
+		source_changed_cache = true;
+		compiled_path = compiled;
+
+		return OK;
+	}
+
+	compiled_path = String();
+
+	CharString src;
 	Error err = Utils::load_file(p_path, src);
 	if (err != OK)
 		return err;
 
-	_set_source_code(src);
+	load_data_released = false;
+	source = src;
+	source_hash = Utils::hash64(source.get_data(), source.length());
+	source_changed_cache = true;
+
 	return OK;
 }
 
@@ -88,16 +123,16 @@ Error LuauScript::compile() {
 #define COMPILE_METHOD "LuauScript::compile"
 
 	dependencies.clear();
+	disk_cache_entry.clear();
+	from_disk_cache = false;
 
 	// See Luau Compiler.cpp
-	CharString src = source.utf8();
-
 	Luau::ParseOptions parse_options;
 	parse_options.captureComments = true;
 
 	Luau::Allocator allocator;
 	Luau::AstNameTable names(allocator);
-	Luau::ParseResult parse_result = Luau::Parser::parse(src.get_data(), src.length() + 1, names, allocator, parse_options);
+	Luau::ParseResult parse_result = Luau::Parser::parse(source.get_data(), source.length() + 1, names, allocator, parse_options);
 	std::string bytecode;
 
 	Error ret = OK;
@@ -128,20 +163,39 @@ Error LuauScript::compile() {
 	return ret;
 }
 
+// Source of script generations. Every bump takes a new, larger value, so the largest generation in a base chain
+// changes whenever any script in the chain changes.
+static std::atomic<uint64_t> method_generation = 1;
+
+void LuauScript::bump_generation() {
+	own_generation.store(++method_generation, std::memory_order_release);
+}
+
+uint64_t LuauScript::get_generation() const {
+	uint64_t generation = 0;
+
+	for (const LuauScript *s = this; s; s = s->base.ptr())
+		generation = MAX(generation, s->own_generation.load(std::memory_order_acquire));
+
+	return generation;
+}
+
 Error LuauScript::analyze() {
 	LuauScriptAnalysisResult analysis_result;
 	GDClassDefinition new_definition;
 
-	analysis_result = luascript_analyze(this, source.utf8().get_data(), luau_data.parse_result, new_definition);
+	analysis_result = luascript_analyze(this, source.get_data(), luau_data.parse_result, new_definition);
 
 	if (!analysis_result.errors.size()) {
 		luau_data.analysis_result = analysis_result;
 		definition = new_definition;
+		bump_generation();
 
 		return OK;
 	} else {
 		luau_data.analysis_result = LuauScriptAnalysisResult();
 		definition = GDClassDefinition();
+		bump_generation();
 
 		for (const AnalysisError &e : analysis_result.errors) {
 			error("LuauScript::analyze", e.message, e.location.begin.line + 1);
@@ -151,6 +205,358 @@ Error LuauScript::analyze() {
 	}
 }
 
+/* DISK CACHE */
+
+#define DISK_CACHE_MAGIC 0x4344554c // LUDC
+
+void LuauScript::update_analysis_hash() {
+	uint64_t hash = Utils::hash64(&source_hash, sizeof(source_hash));
+
+	// Dependency order is not stable
+	Vector<String> paths;
+	HashMap<String, uint64_t> hashes;
+
+	for (const Ref<LuauScript> &dep : dependencies) {
+		paths.push_back(dep->get_path());
+		hashes[dep->get_path()] = dep->analysis_hash;
+	}
+
+	paths.sort();
+
+	for (const String &path : paths) {
+		CharString path_utf8 = path.utf8();
+		hash = Utils::hash64(path_utf8.get_data(), path_utf8.length() + 1, hash);
+		hash = Utils::hash64(&hashes[path], sizeof(uint64_t), hash);
+	}
+
+	analysis_hash = hash;
+}
+
+void LuauScript::clear_syntax_tree() {
+	// The syntax tree lives in the allocator, so drop references to it first
+	luau_data.analysis_result = LuauScriptAnalysisResult();
+	luau_data.parse_result = Luau::ParseResult();
+	luau_data.allocator.~Allocator();
+	new (&luau_data.allocator) Luau::Allocator();
+}
+
+bool LuauScript::set_cache_entry(const Array &p_entry) {
+	if (p_entry.size() != 4)
+		return false;
+
+	PackedByteArray bytecode = p_entry[0];
+	if (bytecode.is_empty())
+		return false;
+
+	dependencies.clear();
+
+	clear_syntax_tree();
+	luau_data.bytecode.assign(reinterpret_cast<const char *>(bytecode.ptr()), bytecode.size());
+
+	if (_is_module) {
+		from_disk_cache = true;
+	} else {
+		disk_cache_entry = p_entry;
+	}
+
+	return true;
+}
+
+Array LuauScript::make_cache_entry(const std::string &p_bytecode) const {
+	PackedByteArray bytecode;
+	bytecode.resize(p_bytecode.size());
+	memcpy(bytecode.ptrw(), p_bytecode.data(), p_bytecode.size());
+
+	Dictionary deps;
+
+	for (const Ref<LuauScript> &dep : dependencies)
+		deps[dep->get_path()] = dep->analysis_hash;
+
+	Array entry;
+	entry.resize(4);
+
+	entry[0] = bytecode;
+	entry[1] = _is_module ? Variant() : Variant(definition.serialize());
+	entry[2] = definition.base_script ? definition.base_script->get_path() : String();
+	entry[3] = deps;
+
+	return entry;
+}
+
+// Reads the bytecode of a matching cache entry. The definition depends on other scripts, so it is checked in apply_disk_cache.
+bool LuauScript::read_disk_cache() {
+	LuauCache *cache = LuauCache::get_singleton();
+	if (!cache || !cache->is_disk_cache_enabled() || !get_path().begins_with("res://"))
+		return false;
+
+	Ref<FileAccess> file = FileAccess::open(cache->get_disk_cache_path(get_path()), FileAccess::READ);
+	if (file.is_null())
+		return false;
+
+	if (file->get_32() != DISK_CACHE_MAGIC || file->get_64() != cache->get_disk_cache_env_hash() || file->get_64() != source_hash)
+		return false;
+
+	return set_cache_entry(file->get_var());
+}
+
+bool LuauScript::apply_disk_cache() {
+	Array entry = disk_cache_entry;
+	disk_cache_entry.clear();
+
+	GDClassDefinition new_definition;
+	if (!GDClassDefinition::deserialize(entry[1], new_definition))
+		return false;
+
+	Dictionary deps = entry[3];
+	Array dep_paths = deps.keys();
+
+	for (int i = 0; i < dep_paths.size(); i++) {
+		Error err = OK;
+		Ref<LuauScript> dep = LuauCache::get_singleton()->get_script(dep_paths[i], err, false, LOAD_ANALYZE);
+
+		if (err != OK || !dep->_is_valid() || !add_dependency(dep))
+			return false;
+
+		// Compiled scripts have no source to check against
+		if (!is_compiled() && dep->analysis_hash != uint64_t(deps[dep_paths[i]]))
+			return false;
+	}
+
+	String base_path = entry[2];
+
+	if (!base_path.is_empty()) {
+		for (const Ref<LuauScript> &dep : dependencies) {
+			if (dep->get_path() == base_path) {
+				new_definition.base_script = dep.ptr();
+				break;
+			}
+		}
+
+		if (!new_definition.base_script)
+			return false;
+	}
+
+	definition = new_definition;
+	from_disk_cache = true;
+	bump_generation();
+
+	return true;
+}
+
+// Objects can't be stored without a resource path, so such definitions are never cached.
+static bool definition_has_objects(const GDClassDefinition &p_def) {
+	for (const GDClassProperty &prop : p_def.properties) {
+		if (prop.default_value.get_type() == Variant::OBJECT)
+			return true;
+	}
+
+	for (const KeyValue<StringName, GDMethod> &E : p_def.methods) {
+		for (const Variant &arg : E.value.default_arguments) {
+			if (arg.get_type() == Variant::OBJECT)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+// Failures are ignored; the entry is just rebuilt next time.
+void LuauScript::save_disk_cache() const {
+	LuauCache *cache = LuauCache::get_singleton();
+	if (!cache || !cache->is_disk_cache_enabled() || from_disk_cache || !get_path().begins_with("res://"))
+		return;
+
+	if (!_is_module && definition_has_objects(definition))
+		return;
+
+	if (luau_data.bytecode.empty())
+		return;
+
+	Array entry = make_cache_entry(luau_data.bytecode);
+
+	Ref<FileAccess> file = FileAccess::open(cache->get_disk_cache_path(get_path()), FileAccess::WRITE);
+	if (file.is_null())
+		return;
+
+	file->store_32(DISK_CACHE_MAGIC);
+	file->store_64(cache->get_disk_cache_env_hash());
+	file->store_64(source_hash);
+	file->store_var(entry);
+}
+
+// Only parses. The definition and dependencies are already known, so the script is not analyzed again.
+Error LuauScript::ensure_syntax_tree() {
+	MutexLock lock(*load_lock.ptr());
+
+	if (luau_data.parse_result.root)
+		return OK;
+
+	if (is_compiled())
+		return ERR_UNAVAILABLE;
+
+	CharString src = source;
+
+	if (load_data_released) {
+		Error err = Utils::load_file(get_path(), src);
+		if (err != OK)
+			return err;
+	}
+
+	clear_syntax_tree();
+
+	// Comments are only needed by the analysis
+	Luau::AstNameTable names(luau_data.allocator);
+	luau_data.parse_result = Luau::Parser::parse(src.get_data(), src.length() + 1, names, luau_data.allocator);
+
+	if (!luau_data.parse_result.errors.empty())
+		return ERR_PARSE_ERROR;
+
+	luau_data.analysis_result = luascript_find_class_type(luau_data.parse_result);
+	return OK;
+}
+
+/* COMPILED SCRIPTS */
+
+// .luauc layout: the header below, followed by a cache entry (see make_cache_entry) encoded with var_to_bytes.
+#define COMPILED_MAGIC 0x4341554c // LUAC
+#define COMPILED_VERSION 1
+#define COMPILED_HEADER_SIZE 20
+
+enum CompiledFlags {
+	COMPILED_MODULE = 1 << 0,
+	COMPILED_STRIPPED = 1 << 1,
+};
+
+Error LuauScript::read_compiled_entry(Array &r_entry) const {
+#define READ_COMPILED_METHOD "LuauScript::read_compiled"
+
+	// Compiled scripts are small; one read avoids seeking around the file
+	PackedByteArray data = FileAccess::get_file_as_bytes(compiled_path);
+
+	if (data.size() < COMPILED_HEADER_SIZE || data.decode_u32(0) != COMPILED_MAGIC) {
+		error(READ_COMPILED_METHOD, "Invalid compiled script at " + compiled_path);
+		return ERR_FILE_CORRUPT;
+	}
+
+	if (data.decode_u32(4) != COMPILED_VERSION || data.decode_u32(8) != LUAU_DEFINITION_FORMAT || data.decode_u32(12) != LBC_VERSION_TARGET) {
+		error(READ_COMPILED_METHOD, "Compiled script at " + compiled_path + " was exported by an incompatible version; re-export the project");
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	if (bool(data.decode_u32(16) & COMPILED_MODULE) != _is_module) {
+		error(READ_COMPILED_METHOD, "Compiled script at " + compiled_path + " does not match the script type of its path");
+		return ERR_FILE_CORRUPT;
+	}
+
+	r_entry = UtilityFunctions::bytes_to_var(data.slice(COMPILED_HEADER_SIZE));
+	return OK;
+}
+
+Error LuauScript::read_compiled() {
+	Array entry;
+	Error err = read_compiled_entry(entry);
+	if (err != OK)
+		return err;
+
+	if (!set_cache_entry(entry)) {
+		error(READ_COMPILED_METHOD, "Invalid compiled script at " + compiled_path);
+		return ERR_FILE_CORRUPT;
+	}
+
+	return OK;
+}
+
+Error LuauScript::export_compiled(bool p_strip_debug_info, PackedByteArray &r_data) {
+	ERR_FAIL_COND_V_MSG(is_compiled(), ERR_UNAVAILABLE, "Script at " + get_path() + " is already compiled");
+
+	Error err = load(LOAD_ANALYZE);
+	if (err != OK)
+		return err;
+
+	ERR_FAIL_COND_V_MSG(!_is_module && definition_has_objects(definition), ERR_UNAVAILABLE, "Cannot compile script at " + get_path() + ": Object default values are not supported");
+
+	// Debug info is kept by default so that errors have line numbers
+	Luau::CompileOptions opts = luaGD_compileopts();
+	opts.debugLevel = p_strip_debug_info ? 0 : 1;
+
+	std::string bytecode = Luau::compile(std::string(source.get_data(), source.length()), opts);
+	ERR_FAIL_COND_V(bytecode.empty() || bytecode[0] == 0, ERR_COMPILATION_FAILED); // Luau encodes errors with version 0
+
+	uint32_t flags = 0;
+
+	if (_is_module)
+		flags |= COMPILED_MODULE;
+
+	if (p_strip_debug_info)
+		flags |= COMPILED_STRIPPED;
+
+	r_data.resize(COMPILED_HEADER_SIZE);
+	r_data.encode_u32(0, COMPILED_MAGIC);
+	r_data.encode_u32(4, COMPILED_VERSION);
+	r_data.encode_u32(8, LUAU_DEFINITION_FORMAT);
+	r_data.encode_u32(12, LBC_VERSION_TARGET);
+	r_data.encode_u32(16, flags);
+	r_data.append_array(UtilityFunctions::var_to_bytes(make_cache_entry(bytecode)));
+
+	return OK;
+}
+
+/* LEAN MODE */
+
+// Frees everything that is only needed to (re)load the script. See LuauCache::set_lean_mode.
+// The bytecode is kept until the table is loaded, and for good unless it can be read back from a compiled script.
+void LuauScript::release_load_data(bool p_free_bytecode) {
+	if (!load_data_released) {
+		clear_syntax_tree();
+		source = CharString();
+		load_data_released = true;
+	}
+
+	if (p_free_bytecode && is_compiled())
+		std::string().swap(luau_data.bytecode);
+}
+
+Error LuauScript::restore_source() {
+	if (!load_data_released)
+		return OK;
+
+	load_data_released = false;
+
+	if (is_compiled())
+		return OK;
+
+	return Utils::load_file(get_path(), source);
+}
+
+// Only the bytecode, to load the table into another VM. Doesn't touch dependencies or the definition.
+Error LuauScript::reload_bytecode() {
+	ERR_FAIL_COND_V_MSG(!is_compiled(), ERR_UNAVAILABLE, "Bytecode of script at " + get_path() + " was not released");
+
+	Array entry;
+	Error err = read_compiled_entry(entry);
+	if (err != OK)
+		return err;
+
+	ERR_FAIL_COND_V_MSG(entry.size() != 4, ERR_FILE_CORRUPT, "Invalid compiled script at " + compiled_path);
+
+	PackedByteArray bytecode = entry[0];
+	ERR_FAIL_COND_V_MSG(bytecode.is_empty(), ERR_FILE_CORRUPT, "Invalid compiled script at " + compiled_path);
+
+	luau_data.bytecode.assign(reinterpret_cast<const char *>(bytecode.ptr()), bytecode.size());
+	return OK;
+}
+
+// Indexed by LuauCallback bit
+static const char *callback_names[CALLBACK_MAX] = {
+	"_Notification",
+	"_Set",
+	"_Get",
+	"_GetPropertyList",
+	"_PropertyCanRevert",
+	"_PropertyGetRevert",
+	"_ToString",
+};
+
 Error LuauScript::finish_load() {
 	// Load script.
 	Error err = reload_tables();
@@ -200,12 +606,21 @@ Error LuauScript::finish_load() {
 
 	lua_pop(L, 1); // table
 
+	own_callbacks = 0;
+
+	for (int i = 0; i < CALLBACK_MAX; i++) {
+		if (methods.has(callback_names[i]))
+			own_callbacks |= 1 << i;
+	}
+
+	// Also covers the base script change above
+	bump_generation();
 	return OK;
 }
 
 Error LuauScript::try_load(lua_State *L, String *r_err) {
 	if (luau_data.bytecode.empty()) {
-		Error err = compile();
+		Error err = load_data_released ? reload_bytecode() : compile();
 		if (err != OK) {
 			if (r_err)
 				*r_err = "Compilation failed";
@@ -237,6 +652,11 @@ Error LuauScript::try_load(lua_State *L, String *r_err) {
 			*r_err = err;
 	}
 
+	// Other VMs load the table on first use, so compiled scripts read the bytecode again then.
+	LuauCache *cache = LuauCache::get_singleton();
+	if (cache && cache->is_lean_mode() && (_is_module || load_stage == LOAD_FULL))
+		release_load_data(true);
+
 	return ret;
 }
 
@@ -253,6 +673,9 @@ String LuauScript::resolve_path(const String &p_relative_path, String &r_error)
 Error LuauScript::load_table(LuauRuntime::VMType p_vm_type, bool p_force) {
 #define LOAD_TABLE_METHOD "LuauScript::load_table"
 
+	// Instances on other threads may request the same table. The lock is recursive, so cyclic requires still hit `_is_loading`.
+	MutexLock lock(*load_lock.ptr());
+
 	if (table_refs[p_vm_type]) {
 		if (!p_force)
 			return OK;
@@ -298,6 +721,7 @@ Error LuauScript::load_table(LuauRuntime::VMType p_vm_type, bool p_force) {
 		}
 
 		table_refs[p_vm_type] = lua_ref(T, 1);
+		bump_generation();
 
 		lua_pop(L, 1); // thread
 		_is_loading = false;
@@ -336,10 +760,18 @@ Error LuauScript::reload_tables() {
 }
 
 Error LuauScript::load(LoadStage p_load_stage, bool p_force) {
+	MutexLock lock(*load_lock.ptr());
+
 	int current_stage = 0;
 
 	if (p_force) {
 		current_stage = LOAD_NONE;
+
+		Error err = restore_source();
+		if (err != OK) {
+			valid = false;
+			return err;
+		}
 	} else {
 		current_stage = load_stage;
 
@@ -352,13 +784,49 @@ Error LuauScript::load(LoadStage p_load_stage, bool p_force) {
 	while (++current_stage <= p_load_stage) {
 		switch (current_stage) {
 			case LOAD_COMPILE:
+				if (is_compiled()) {
+					err = read_compiled();
+					break;
+				}
+
+				if (read_disk_cache())
+					break;
+
 				err = compile();
+
+				if (err == OK && _is_module)
+					save_disk_cache();
+
 				break;
 
 			case LOAD_ANALYZE:
-				if (!_is_module)
+				if (!_is_module) {
+					if (!disk_cache_entry.is_empty()) {
+						if (apply_disk_cache()) {
+							update_analysis_hash();
+							break;
+						}
+
+						if (is_compiled()) {
+							error("LuauScript::load", "Failed to resolve the base script or dependencies of compiled script at " + compiled_path);
+							err = ERR_FILE_MISSING_DEPENDENCIES;
+							break;
+						}
+
+						// Stale (e.g. a dependency changed)
+						err = compile();
+						if (err != OK)
+							break;
+					}
+
 					err = analyze();
 
+					if (err == OK) {
+						update_analysis_hash();
+						save_disk_cache();
+					}
+				}
+
 				break;
 
 			case LOAD_FULL:
@@ -377,7 +845,14 @@ Error LuauScript::load(LoadStage p_load_stage, bool p_force) {
 		}
 	}
 
-	load_stage = p_load_stage;
+	// Don't go back a stage if an earlier one was requested (e.g. from a loader thread)
+	if (p_force || p_load_stage > load_stage)
+		load_stage = p_load_stage;
+
+	LuauCache *cache = LuauCache::get_singleton();
+	if (cache && cache->is_lean_mode() && !_is_module && load_stage >= LOAD_ANALYZE)
+		release_load_data(load_stage == LOAD_FULL);
+
 	valid = true;
 	return OK;
 }
@@ -386,10 +861,7 @@ Error LuauScript::_reload(bool p_keep_state) {
 	if (_is_module)
 		return OK;
 
-	{
-		MutexLock lock(*LuauLanguage::singleton->lock.ptr());
-		ERR_FAIL_COND_V(!p_keep_state && instances.size() > 0, ERR_ALREADY_IN_USE);
-	}
+	ERR_FAIL_COND_V(!p_keep_state && instances.size() > 0, ERR_ALREADY_IN_USE);
 
 	return load(LOAD_FULL, true);
 }
@@ -450,10 +922,9 @@ StringName LuauScript::_get_global_name() const {
 }
 
 TypedArray<Dictionary> LuauScript::_get_script_method_list() const {
-	TypedArray<Dictionary> methods;
-
-	for (const KeyValue<StringName, GDMethod> &pair : definition.methods)
-		methods.push_back(pair.value);
+	LuauReflection *r = get_reflection();
+	TypedArray<Dictionary> methods = r->script_methods;
+	r->unreference();
 
 	return methods;
 }
@@ -493,19 +964,9 @@ Dictionary LuauScript::_get_method_info(const StringName &p_method) const {
 }
 
 TypedArray<Dictionary> LuauScript::_get_script_property_list() const {
-	TypedArray<Dictionary> properties;
-
-	const LuauScript *s = this;
-
-	while (s) {
-		// Reverse to add properties from base scripts first.
-		for (int i = definition.properties.size() - 1; i >= 0; i--) {
-			const GDClassProperty &prop = definition.properties[i];
-			properties.push_front(prop.property.operator Dictionary());
-		}
-
-		s = s->base.ptr();
-	}
+	LuauReflection *r = get_reflection();
+	TypedArray<Dictionary> properties = r->script_properties;
+	r->unreference();
 
 	return properties;
 }
@@ -556,44 +1017,46 @@ bool LuauScript::_has_script_signal(const StringName &p_signal) const {
 }
 
 TypedArray<Dictionary> LuauScript::_get_script_signal_list() const {
-	TypedArray<Dictionary> signals;
-
-	const LuauScript *s = this;
-
-	while (s) {
-		for (const KeyValue<StringName, GDMethod> &pair : s->definition.signals)
-			signals.push_back(pair.value);
-
-		s = s->base.ptr();
-	}
+	LuauReflection *r = get_reflection();
+	TypedArray<Dictionary> signals = r->script_signals;
+	r->unreference();
 
 	return signals;
 }
 
 Variant LuauScript::_get_rpc_config() const {
-	Dictionary rpcs;
-
-	const LuauScript *s = this;
-
-	while (s) {
-		for (const KeyValue<StringName, GDRpc> &pair : s->definition.rpcs)
-			rpcs[pair.key] = pair.value;
-
-		s = s->base.ptr();
-	}
+	LuauReflection *r = get_reflection();
+	Dictionary rpcs = r->rpc_config;
+	r->unreference();
 
 	return rpcs;
 }
 
 Dictionary LuauScript::_get_constants() const {
-	Dictionary constants_dict;
-
-	for (const KeyValue<StringName, Variant> &pair : constants)
-		constants_dict[pair.key] = pair.value;
+	LuauReflection *r = get_reflection();
+	Dictionary constants_dict = r->constants;
+	r->unreference();
 
 	return constants_dict;
 }
 
+LuauReflection *LuauScript::get_reflection() const {
+	MutexLock lock(*reflection_lock.ptr());
+
+	uint64_t generation = get_generation();
+
+	if (!reflection || reflection->generation != generation) {
+		if (reflection)
+			reflection->unreference();
+
+		reflection = memnew(LuauReflection(this));
+		reflection->generation = generation;
+	}
+
+	reflection->reference();
+	return reflection;
+}
+
 void *LuauScript::_instance_create(Object *p_for_object) const {
 	LuauRuntime::VMType type = LuauRuntime::VM_USER;
 
@@ -612,7 +1075,6 @@ void *LuauScript::_instance_create(Object *p_for_object) const {
 }
 
 bool LuauScript::instance_has(uint64_t p_obj_id) const {
-	MutexLock lock(*LuauLanguage::singleton->lock.ptr());
 	return instances.has(p_obj_id);
 }
 
@@ -621,7 +1083,6 @@ bool LuauScript::_instance_has(Object *p_object) const {
 }
 
 LuauScriptInstance *LuauScript::instance_get(uint64_t p_obj_id) const {
-	MutexLock lock(*LuauLanguage::singleton->lock.ptr());
 	return instances.get(p_obj_id);
 }
 
@@ -641,21 +1102,266 @@ void LuauScript::def_table_get(const ThreadHandle &T) const {
 	lua_remove(T, -2);
 }
 
-bool LuauScript::has_dependency(const Ref<LuauScript> &p_script) const {
-	return dependencies.has(p_script);
-}
-
-bool LuauScript::add_dependency(const Ref<LuauScript> &p_script) {
-	if (p_script->has_dependency(this))
-		return false;
+// Entries are freed outside the cache lock, since freeing them takes VM locks.
+void LuauScript::clear_method_cache(LocalVector<LuauResolvedMethod *> &r_stale) const {
+	for (const KeyValue<StringName, LuauResolvedMethod *> &E : method_cache)
+		r_stale.push_back(E.value);
 
-	dependencies.insert(p_script);
-	return true;
+	method_cache.clear();
 }
 
-void LuauScript::error(const char *p_method, const String &p_msg, int p_line) const {
-	luaGD_gderror(p_method, get_path(), p_msg, p_line);
-}
+LuauResolvedMethodRef LuauScript::resolve_method(const StringName &p_method) const {
+	LocalVector<LuauResolvedMethod *> stale;
+	LuauResolvedMethod *ret = nullptr;
+
+	{
+		MutexLock lock(*method_cache_lock.ptr());
+
+		uint64_t generation = get_generation();
+		HashMap<StringName, LuauResolvedMethod *>::ConstIterator E;
+
+		if (method_cache_generation == generation) {
+			E = method_cache.find(p_method);
+		} else {
+			clear_method_cache(stale);
+			method_cache_generation = generation;
+		}
+
+		if (E) {
+			ret = E->value;
+		} else {
+			// Misses are cached too
+			ret = memnew(LuauResolvedMethod);
+
+			const LuauScript *s = this;
+
+			while (s) {
+				StringName actual_name = p_method;
+
+				// check name given and name converted to pascal
+				// (e.g. if Node::_ready is called -> _Ready)
+				if (s->has_method(p_method, &actual_name)) {
+					ret->found = true;
+					ret->method = s->definition.methods[actual_name];
+					ret->name = actual_name;
+					break;
+				}
+
+				s = s->base.ptr();
+			}
+
+			if (ret->found) {
+				const GDMethod &method = ret->method;
+
+				// Overrides without a registration still take precedence (see call_internal)
+				String name = ret->name;
+				s = this;
+
+				while (s) {
+					if (s->methods.has(name)) {
+						ret->function_script = s;
+						break;
+					}
+
+					s = s->base.ptr();
+				}
+
+				ret->args_required = method.arguments.size() - method.default_arguments.size();
+				ret->arg_types.resize(method.arguments.size());
+
+				for (int i = 0; i < method.arguments.size(); i++) {
+					const GDProperty &arg = method.arguments[i];
+					ret->arg_types[i] = (arg.usage & PROPERTY_USAGE_NIL_IS_VARIANT) ? Variant::VARIANT_MAX : Variant::Type(arg.type);
+				}
+			}
+
+			method_cache.insert(p_method, ret);
+		}
+
+		if (ret->found)
+			ret->reference();
+		else
+			ret = nullptr;
+	}
+
+	for (LuauResolvedMethod *method : stale)
+		method->unreference();
+
+	return LuauResolvedMethodRef(ret);
+}
+
+int LuauScript::get_property_slot_offset() const {
+	uint64_t generation = get_generation();
+
+	if (property_slot_generation.load(std::memory_order_acquire) != generation) {
+		int offset = 0;
+
+		for (const LuauScript *s = base.ptr(); s; s = s->base.ptr())
+			offset += s->definition.properties.size();
+
+		property_slot_offset.store(offset, std::memory_order_relaxed);
+		property_slot_generation.store(generation, std::memory_order_release);
+	}
+
+	return property_slot_offset.load(std::memory_order_relaxed);
+}
+
+uint32_t LuauScript::get_callbacks() const {
+	uint64_t generation = get_generation();
+
+	if (callbacks_generation.load(std::memory_order_acquire) != generation) {
+		uint32_t mask = 0;
+
+		for (const LuauScript *s = this; s; s = s->base.ptr())
+			mask |= s->own_callbacks;
+
+		callbacks.store(mask, std::memory_order_relaxed);
+		callbacks_generation.store(generation, std::memory_order_release);
+	}
+
+	return callbacks.load(std::memory_order_relaxed);
+}
+
+bool LuauScript::resolved_function_get(const ThreadHandle &T, const LuauResolvedMethod &p_method) const {
+	GDThreadData *udata = luaGD_getthreaddata(T);
+	ERR_FAIL_COND_V_MSG(udata->vm_type >= LuauRuntime::VM_MAX, false, "Thread has an unknown VM type");
+
+	if (!p_method.function_script)
+		return false;
+
+	std::atomic<int> &ref = p_method.function_refs[udata->vm_type];
+	int existing = ref.load(std::memory_order_acquire);
+
+	if (existing) {
+		lua_getref(T, existing);
+		return true;
+	}
+
+	LuaStackOp<String>::push(T, p_method.name);
+	p_method.function_script->def_table_get(T);
+
+	if (!lua_isfunction(T, -1)) {
+		lua_pop(T, 1);
+		return false;
+	}
+
+	ref.store(lua_ref(T, -1), std::memory_order_release);
+	return true;
+}
+
+// Instance threads only carry the script and permissions for borrowed execution threads
+// (functions use their own environment), so one is shared by all instances in a VM.
+lua_State *LuauScript::acquire_instance_thread(const ThreadHandle &L, LuauRuntime::VMType p_vm_type, BitField<ThreadPermissions> p_permissions) {
+	InstanceThread &thread = instance_threads[p_vm_type];
+
+	if (!thread.thread) {
+		thread.thread = luaGD_newthread(L, p_permissions);
+		luaL_sandboxthread(thread.thread);
+
+		GDThreadData *udata = luaGD_getthreaddata(thread.thread);
+		udata->script = Ref<LuauScript>(this);
+
+		thread.ref = lua_ref(L, -1);
+		lua_pop(L, 1); // thread
+	}
+
+	thread.users++;
+	return thread.thread;
+}
+
+void LuauScript::release_instance_thread(const ThreadHandle &L, LuauRuntime::VMType p_vm_type) {
+	InstanceThread &thread = instance_threads[p_vm_type];
+	ERR_FAIL_COND_MSG(thread.users == 0, "Instance thread released too many times");
+
+	if (--thread.users > 0)
+		return;
+
+	// See ~LuauScriptInstance
+	if (L && luaGD_getthreaddata(L))
+		lua_unref(L, thread.ref);
+
+	thread = InstanceThread();
+}
+
+void LuauScript::free_instance_templates() {
+	for (int i = 0; i < LuauRuntime::VM_MAX; i++) {
+		InstanceTemplate &tmpl = instance_templates[i];
+
+		if (tmpl.prototype_ref) {
+			ThreadHandle L = LuauRuntime::get_singleton()->get_vm(LuauRuntime::VMType(i));
+
+			// See ~LuauScriptInstance
+			if (L && luaGD_getthreaddata(L)) {
+				lua_unref(L, tmpl.prototype_ref);
+				lua_unref(L, tmpl.init_ref);
+			}
+		}
+
+		tmpl = InstanceTemplate();
+	}
+}
+
+// Must be called with the VM locked (i.e. from an instance thread).
+const LuauScript::InstanceTemplate &LuauScript::get_instance_template(const ThreadHandle &T) const {
+	GDThreadData *udata = luaGD_getthreaddata(T);
+	CRASH_COND_MSG(udata->vm_type >= LuauRuntime::VM_MAX, "Thread has an unknown VM type");
+
+	InstanceTemplate &tmpl = instance_templates[udata->vm_type];
+	uint64_t generation = get_generation();
+
+	if (tmpl.prototype_ref && tmpl.generation == generation)
+		return tmpl;
+
+	if (tmpl.prototype_ref) {
+		lua_unref(T, tmpl.prototype_ref);
+		lua_unref(T, tmpl.init_ref);
+	}
+
+	// Builtin userdata can't be mutated in place and instance getters copy values out of the table,
+	// so defaults can be shared between instances.
+	lua_createtable(T, get_property_slot_count(), 0);
+
+	for (const LuauScript *s = this; s; s = s->base.ptr()) {
+		const Vector<GDClassProperty> &properties = s->definition.properties;
+
+		for (int i = 0; i < properties.size(); i++) {
+			const GDClassProperty &prop = properties[i];
+
+			if (prop.getter == StringName() && prop.setter == StringName()) {
+				LuaStackOp<Variant>::push(T, prop.default_value);
+				lua_rawseti(T, -2, s->get_property_slot(i));
+			}
+		}
+	}
+
+	tmpl.prototype_ref = lua_ref(T, -1);
+	lua_pop(T, 1); // prototype
+
+	LuaStackOp<String>::push(T, "_Init");
+	def_table_get(T);
+
+	tmpl.init_ref = lua_isfunction(T, -1) ? lua_ref(T, -1) : LUA_NOREF;
+	lua_pop(T, 1); // _Init
+
+	tmpl.generation = generation;
+	return tmpl;
+}
+
+bool LuauScript::has_dependency(const Ref<LuauScript> &p_script) const {
+	return dependencies.has(p_script);
+}
+
+bool LuauScript::add_dependency(const Ref<LuauScript> &p_script) {
+	if (p_script->has_dependency(this))
+		return false;
+
+	dependencies.insert(p_script);
+	return true;
+}
+
+void LuauScript::error(const char *p_method, const String &p_msg, int p_line) const {
+	luaGD_gderror(p_method, get_path(), p_msg, p_line);
+}
 
 // Based on Luau Repl implementation.
 void LuauScript::load_module(lua_State *L) {
@@ -703,6 +1409,10 @@ void LuauScript::load_module(lua_State *L) {
 
 LuauScript::LuauScript() :
 		script_list(this) {
+	method_cache_lock.instantiate();
+	reflection_lock.instantiate();
+	load_lock.instantiate();
+
 	{
 		MutexLock lock(*LuauLanguage::get_singleton()->lock.ptr());
 		LuauLanguage::get_singleton()->script_list.add(&script_list);
@@ -710,9 +1420,22 @@ LuauScript::LuauScript() :
 }
 
 LuauScript::~LuauScript() {
+	if (reflection) {
+		reflection->unreference();
+		reflection = nullptr;
+	}
+
 	if (!LuauRuntime::get_singleton())
 		return;
 
+	LocalVector<LuauResolvedMethod *> stale_methods;
+	clear_method_cache(stale_methods);
+
+	for (LuauResolvedMethod *method : stale_methods)
+		method->unreference();
+
+	free_instance_templates();
+
 	for (int i = 0; i < LuauRuntime::VM_MAX; i++) {
 		if (table_refs[i]) {
 			unref_table(LuauRuntime::VMType(i));
@@ -729,6 +1452,181 @@ LuauScript::~LuauScript() {
 	}
 }
 
+void LuauInstanceRegistry::insert(uint64_t p_obj_id, LuauScriptInstance *p_instance) {
+	Shard &shard = get_shard(p_obj_id);
+	std::lock_guard<std::mutex> lock(shard.lock);
+
+	if (!shard.instances.has(p_obj_id))
+		count.fetch_add(1, std::memory_order_relaxed);
+
+	shard.instances.insert(p_obj_id, p_instance);
+}
+
+void LuauInstanceRegistry::erase(uint64_t p_obj_id) {
+	Shard &shard = get_shard(p_obj_id);
+	std::lock_guard<std::mutex> lock(shard.lock);
+
+	if (shard.instances.erase(p_obj_id))
+		count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool LuauInstanceRegistry::has(uint64_t p_obj_id) const {
+	const Shard &shard = get_shard(p_obj_id);
+	std::lock_guard<std::mutex> lock(shard.lock);
+
+	return shard.instances.has(p_obj_id);
+}
+
+LuauScriptInstance *LuauInstanceRegistry::get(uint64_t p_obj_id) const {
+	const Shard &shard = get_shard(p_obj_id);
+	std::lock_guard<std::mutex> lock(shard.lock);
+
+	HashMap<uint64_t, LuauScriptInstance *>::ConstIterator E = shard.instances.find(p_obj_id);
+	return E ? E->value : nullptr;
+}
+
+HashMap<uint64_t, LuauScriptInstance *> LuauInstanceRegistry::get_all() const {
+	HashMap<uint64_t, LuauScriptInstance *> all;
+
+	for (const Shard &shard : shards) {
+		std::lock_guard<std::mutex> lock(shard.lock);
+
+		for (const KeyValue<uint64_t, LuauScriptInstance *> &E : shard.instances)
+			all.insert(E.key, E.value);
+	}
+
+	return all;
+}
+
+void LuauScript::process_group_add(LuauScriptInstance *p_instance) {
+	std::lock_guard<std::mutex> lock(process_group_lock);
+
+	p_instance->process_group_index = process_group.size();
+	process_group.push_back(p_instance);
+
+	if (process_group.size() == 1) {
+		MutexLock lang_lock(*LuauLanguage::singleton->lock.ptr());
+		LuauLanguage::singleton->process_group_scripts.insert(this);
+	}
+}
+
+void LuauScript::process_group_remove(LuauScriptInstance *p_instance) {
+	std::lock_guard<std::mutex> lock(process_group_lock);
+
+	int idx = p_instance->process_group_index;
+	ERR_FAIL_INDEX(idx, int(process_group.size()));
+
+	process_group[idx] = process_group[process_group.size() - 1];
+	process_group[idx]->process_group_index = idx;
+	process_group.resize(process_group.size() - 1);
+
+	p_instance->process_group_index = -1;
+
+	if (process_group.is_empty()) {
+		MutexLock lang_lock(*LuauLanguage::singleton->lock.ptr());
+		LuauLanguage::singleton->process_group_scripts.erase(this);
+	}
+}
+
+static const StringName &process_method_name(bool p_physics) {
+	static const StringName process_name = "_process";
+	static const StringName physics_process_name = "_physics_process";
+
+	return p_physics ? physics_process_name : process_name;
+}
+
+// Calls _Process or _PhysicsProcess on every grouped instance, from one execution thread per VM.
+// The engine never processes grouped nodes itself (see LuauScriptInstance::has_method).
+void LuauScript::run_process_group(bool p_physics) {
+#define PROCESS_GROUP_METHOD "LuauScript::run_process_group"
+	LuauResolvedMethodRef method = resolve_method(process_method_name(p_physics));
+	if (!method || !method->function_script)
+		return;
+
+	struct Entry {
+		uint64_t id;
+		LuauRuntime::VMType vm_type;
+		int priority;
+
+		bool operator<(const Entry &p_other) const { return priority < p_other.priority; }
+	};
+
+	// Instances can be freed by the calls, so they are looked up again by ID.
+	LocalVector<Entry> entries;
+
+	{
+		std::lock_guard<std::mutex> lock(process_group_lock);
+
+		if (process_group.is_empty())
+			return;
+
+		entries.resize(process_group.size());
+
+		for (uint32_t i = 0; i < process_group.size(); i++) {
+			LuauScriptInstance *inst = process_group[i];
+			nb::Node node(inst->get_owner()->_owner);
+
+			entries[i] = { inst->get_owner()->get_instance_id(), inst->get_vm_type(),
+				p_physics ? node.get_physics_process_priority() : node.get_process_priority() };
+		}
+	}
+
+	entries.sort();
+
+	lua_State *threads[LuauRuntime::VM_MAX] = { nullptr };
+	bool failed[LuauRuntime::VM_MAX] = { false };
+	double delta = -1;
+
+	for (const Entry &E : entries) {
+		if (failed[E.vm_type])
+			continue;
+
+		LuauScriptInstance *inst = instances.get(E.id);
+		if (!inst)
+			continue;
+
+		nb::Node node(inst->get_owner()->_owner);
+		if (!node.is_inside_tree() || !node.can_process())
+			continue;
+
+		if (delta < 0)
+			delta = p_physics ? node.get_physics_process_delta_time() : node.get_process_delta_time();
+
+		lua_State *&ET = threads[E.vm_type];
+
+		if (!ET) {
+			ET = luaGD_borrowthread(inst->T);
+
+			if (!resolved_function_get(ET, *method)) {
+				luaGD_releasethread(LuauRuntime::get_singleton()->get_vm(E.vm_type), ET);
+				ET = nullptr;
+				failed[E.vm_type] = true;
+				continue;
+			}
+		}
+
+		lua_pushvalue(ET, -1); // function
+		inst->push_self(ET);
+		lua_pushnumber(ET, delta);
+
+		int status = luascript_pcall(ET, 2, 0, 0);
+
+		if (status == LUA_YIELD) {
+			// The thread now belongs to the scheduler
+			luaGD_releasethread(LuauRuntime::get_singleton()->get_vm(E.vm_type), ET);
+			ET = nullptr;
+		} else if (status != LUA_OK) {
+			error(PROCESS_GROUP_METHOD, LuaStackOp<String>::get(ET, -1));
+			lua_pop(ET, 1); // error
+		}
+	}
+
+	for (int i = 0; i < LuauRuntime::VM_MAX; i++) {
+		if (threads[i])
+			luaGD_releasethread(LuauRuntime::get_singleton()->get_vm(LuauRuntime::VMType(i)), threads[i]);
+	}
+}
+
 ////////////////////////////
 // SCRIPT INSTANCE COMMON //
 ////////////////////////////
@@ -868,70 +1766,112 @@ void ScriptInstance::get_property_state(List<Pair<StringName, Variant>> &p_list)
 	get_property_state(add_to_state, &p_list);
 }
 
+// Lists handed to the engine are prefixed with this header.
+// The first shared_count entries belong to the reflection data and are not freed with the list.
+struct ReflectionListHeader {
+	LuauReflection *reflection;
+	uint64_t shared_count;
+};
+
+template <typename T>
+static T *reflection_list_alloc(LuauReflection *p_reflection, uint32_t p_shared_count, uint32_t p_count) {
+	ReflectionListHeader *header = (ReflectionListHeader *)memalloc(sizeof(ReflectionListHeader) + sizeof(T) * p_count);
+	header->reflection = p_reflection;
+	header->shared_count = p_shared_count;
+
+	if (p_reflection)
+		p_reflection->reference();
+
+	return (T *)(header + 1);
+}
+
+static ReflectionListHeader *reflection_list_header(const void *p_list) {
+	return ((ReflectionListHeader *)p_list) - 1;
+}
+
+static void reflection_list_free(const void *p_list) {
+	ReflectionListHeader *header = reflection_list_header(p_list);
+
+	if (header->reflection)
+		header->reflection->unreference();
+
+	memfree(header);
+}
+
+GDExtensionPropertyInfo *ScriptInstance::alloc_property_list(LuauReflection *p_reflection, uint32_t p_shared_count, uint32_t p_count) {
+	GDExtensionPropertyInfo *list = reflection_list_alloc<GDExtensionPropertyInfo>(p_reflection, p_shared_count, p_count);
+
+	if (p_shared_count > 0)
+		memcpy(list, p_reflection->properties.ptr(), sizeof(GDExtensionPropertyInfo) * p_shared_count);
+
+	return list;
+}
+
 void ScriptInstance::free_property_list(const GDExtensionPropertyInfo *p_list, uint32_t p_count) const {
 	if (!p_list)
 		return;
 
-	for (int i = 0; i < p_count; i++)
+	for (int i = reflection_list_header(p_list)->shared_count; i < p_count; i++)
 		free_prop(p_list[i]);
 
-	memfree((GDExtensionPropertyInfo *)p_list);
+	reflection_list_free(p_list);
 }
 
-GDExtensionMethodInfo *ScriptInstance::get_method_list(uint32_t *r_count) const {
-	LocalVector<GDExtensionMethodInfo> methods;
-	HashSet<StringName> defined;
-
-	const LuauScript *s = get_script().ptr();
-
-	while (s) {
-		for (const KeyValue<StringName, GDMethod> &pair : s->get_definition().methods) {
-			if (defined.has(pair.key))
-				continue;
+static void copy_method(const GDMethod &p_src, GDExtensionMethodInfo &p_dst, void (*p_copy_prop)(const GDProperty &, GDExtensionPropertyInfo &)) {
+	p_dst.name = stringname_alloc(p_src.name);
+	p_copy_prop(p_src.return_val, p_dst.return_value);
+	p_dst.flags = p_src.flags;
+	p_dst.argument_count = p_src.arguments.size();
+	p_dst.arguments = nullptr;
 
-			defined.insert(pair.key);
+	if (p_dst.argument_count > 0) {
+		GDExtensionPropertyInfo *arg_list = memnew_arr(GDExtensionPropertyInfo, p_dst.argument_count);
 
-			const GDMethod &src = pair.value;
+		for (int j = 0; j < p_dst.argument_count; j++)
+			p_copy_prop(p_src.arguments[j], arg_list[j]);
 
-			GDExtensionMethodInfo dst;
+		p_dst.arguments = arg_list;
+	}
 
-			dst.name = stringname_alloc(src.name);
-			copy_prop(src.return_val, dst.return_value);
-			dst.flags = src.flags;
-			dst.argument_count = src.arguments.size();
+	p_dst.default_argument_count = p_src.default_arguments.size();
+	p_dst.default_arguments = nullptr;
 
-			if (dst.argument_count > 0) {
-				GDExtensionPropertyInfo *arg_list = memnew_arr(GDExtensionPropertyInfo, dst.argument_count);
+	if (p_dst.default_argument_count > 0) {
+		Variant *defargs = memnew_arr(Variant, p_dst.default_argument_count);
 
-				for (int j = 0; j < dst.argument_count; j++)
-					copy_prop(src.arguments[j], arg_list[j]);
+		for (int j = 0; j < p_dst.default_argument_count; j++)
+			defargs[j] = p_src.default_arguments[j];
 
-				dst.arguments = arg_list;
-			}
+		p_dst.default_arguments = (GDExtensionVariantPtr *)defargs;
+	}
+}
 
-			dst.default_argument_count = src.default_arguments.size();
+static void free_method(const GDExtensionMethodInfo &p_method, void (*p_free_prop)(const GDExtensionPropertyInfo &)) {
+	memdelete((StringName *)p_method.name);
 
-			if (dst.default_argument_count > 0) {
-				Variant *defargs = memnew_arr(Variant, dst.default_argument_count);
+	p_free_prop(p_method.return_value);
 
-				for (int j = 0; j < dst.default_argument_count; j++)
-					defargs[j] = src.default_arguments[j];
+	if (p_method.argument_count > 0) {
+		for (int i = 0; i < p_method.argument_count; i++)
+			p_free_prop(p_method.arguments[i]);
 
-				dst.default_arguments = (GDExtensionVariantPtr *)defargs;
-			}
+		memdelete_arr(p_method.arguments);
+	}
 
-			methods.push_back(dst);
-		}
+	if (p_method.default_argument_count > 0)
+		memdelete_arr((Variant *)p_method.default_arguments);
+}
 
-		s = s->get_base().ptr();
-	}
+GDExtensionMethodInfo *ScriptInstance::get_method_list(uint32_t *r_count) const {
+	LuauReflection *r = get_script()->get_reflection();
 
-	int size = methods.size();
+	uint32_t size = r->methods.size();
 	*r_count = size;
 
-	GDExtensionMethodInfo *list = (GDExtensionMethodInfo *)memalloc(sizeof(GDExtensionMethodInfo) * size);
-	memcpy(list, methods.ptr(), sizeof(GDExtensionMethodInfo) * size);
+	GDExtensionMethodInfo *list = reflection_list_alloc<GDExtensionMethodInfo>(r, size, size);
+	memcpy(list, r->methods.ptr(), sizeof(GDExtensionMethodInfo) * size);
 
+	r->unreference();
 	return list;
 }
 
@@ -939,36 +1879,150 @@ void ScriptInstance::free_method_list(const GDExtensionMethodInfo *p_list, uint3
 	if (!p_list)
 		return;
 
-	for (int i = 0; i < p_count; i++) {
-		const GDExtensionMethodInfo &method = p_list[i];
+	for (int i = reflection_list_header(p_list)->shared_count; i < p_count; i++)
+		free_method(p_list[i], free_prop);
 
-		memdelete((StringName *)method.name);
+	reflection_list_free(p_list);
+}
 
-		free_prop(method.return_value);
+static Variant read_only_copy(const Variant &p_value);
 
-		if (method.argument_count > 0) {
-			for (int i = 0; i < method.argument_count; i++)
-				free_prop(method.arguments[i]);
+static void make_entries_read_only(Array &r_array) {
+	for (int64_t i = 0; i < r_array.size(); i++)
+		r_array[i] = read_only_copy(r_array[i]);
 
-			memdelete(method.arguments);
-		}
+	r_array.make_read_only();
+}
 
-		if (method.default_argument_count > 0)
-			memdelete((Variant *)method.default_arguments);
-	}
+static void make_entries_read_only(Dictionary &r_dict) {
+	Array keys = r_dict.keys();
 
-	memdelete((GDExtensionMethodInfo *)p_list);
+	for (int64_t i = 0; i < keys.size(); i++)
+		r_dict[keys[i]] = read_only_copy(r_dict[keys[i]]);
+
+	r_dict.make_read_only();
 }
 
-ScriptLanguage *ScriptInstance::get_language() const {
-	return LuauLanguage::get_singleton();
+// Nested containers may be shared with the script (e.g. constant values), so they are copied before being locked.
+static Variant read_only_copy(const Variant &p_value) {
+	if (p_value.get_type() == Variant::ARRAY) {
+		Array arr = p_value.operator Array().duplicate();
+		make_entries_read_only(arr);
+		return arr;
+	} else if (p_value.get_type() == Variant::DICTIONARY) {
+		Dictionary dict = p_value.operator Dictionary().duplicate();
+		make_entries_read_only(dict);
+		return dict;
+	}
+
+	return p_value;
 }
 
-/////////////////////
-// SCRIPT INSTANCE //
-/////////////////////
+LuauReflection::LuauReflection(const LuauScript *p_script) {
+	HashSet<StringName> defined;
 
-#define INSTANCE_SELF ((LuauScriptInstance *)p_self)
+	// Push properties in reverse then reverse the entire vector.
+	// Ensures base properties are first.
+	for (const LuauScript *s = p_script; s; s = s->base.ptr()) {
+		for (int i = s->definition.properties.size() - 1; i >= 0; i--) {
+			const GDClassProperty &prop = s->definition.properties[i];
+
+			if (defined.has(prop.property.name))
+				continue;
+
+			defined.insert(prop.property.name);
+
+			GDExtensionPropertyInfo dst;
+			ScriptInstance::copy_prop(prop.property, dst);
+
+			properties.push_back(dst);
+			script_properties.push_back(prop.property.operator Dictionary());
+		}
+	}
+
+	properties.invert();
+	script_properties.reverse();
+
+	defined.clear();
+
+	for (const LuauScript *s = p_script; s; s = s->base.ptr()) {
+		for (const KeyValue<StringName, GDMethod> &pair : s->definition.methods) {
+			if (defined.has(pair.key))
+				continue;
+
+			defined.insert(pair.key);
+
+			GDExtensionMethodInfo dst;
+			copy_method(pair.value, dst, ScriptInstance::copy_prop);
+
+			methods.push_back(dst);
+		}
+
+		for (const KeyValue<StringName, GDMethod> &pair : s->definition.signals)
+			script_signals.push_back(pair.value);
+
+		for (const KeyValue<StringName, GDRpc> &pair : s->definition.rpcs)
+			rpc_config[pair.key] = pair.value;
+	}
+
+	for (const KeyValue<StringName, GDMethod> &pair : p_script->definition.methods)
+		script_methods.push_back(pair.value);
+
+	for (const KeyValue<StringName, Variant> &pair : p_script->constants)
+		constants[pair.key] = pair.value;
+
+	// Handed out without copying, so nested entries are read-only too
+	make_entries_read_only(script_methods);
+	make_entries_read_only(script_properties);
+	make_entries_read_only(script_signals);
+	make_entries_read_only(rpc_config);
+	make_entries_read_only(constants);
+}
+
+LuauReflection::~LuauReflection() {
+	for (const GDExtensionPropertyInfo &prop : properties)
+		ScriptInstance::free_prop(prop);
+
+	for (const GDExtensionMethodInfo &method : methods)
+		free_method(method, ScriptInstance::free_prop);
+}
+
+void LuauResolvedMethod::unreference() {
+	if (refcount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		memdelete(this);
+}
+
+LuauResolvedMethod::~LuauResolvedMethod() {
+	if (!LuauRuntime::get_singleton())
+		return;
+
+	for (int i = 0; i < LuauRuntime::VM_MAX; i++) {
+		int ref = function_refs[i].load(std::memory_order_acquire);
+		if (!ref)
+			continue;
+
+		ThreadHandle L = LuauRuntime::get_singleton()->get_vm(LuauRuntime::VMType(i));
+
+		// See ~LuauScriptInstance
+		if (L && luaGD_getthreaddata(L))
+			lua_unref(L, ref);
+	}
+}
+
+void LuauReflection::unreference() {
+	if (refcount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		memdelete(this);
+}
+
+ScriptLanguage *ScriptInstance::get_language() const {
+	return LuauLanguage::get_singleton();
+}
+
+/////////////////////
+// SCRIPT INSTANCE //
+/////////////////////
+
+#define INSTANCE_SELF ((LuauScriptInstance *)p_self)
 
 static GDExtensionScriptInstanceInfo3 init_script_instance_info() {
 	GDExtensionScriptInstanceInfo3 info;
@@ -1021,28 +2075,47 @@ int LuauScriptInstance::call_internal(const StringName &p_method, const ThreadHa
 				return -1;
 			}
 
-			lua_insert(ET, -p_nargs - 1);
+			return call_function(s, ET, p_nargs, p_nret);
+		}
+
+		s = s->base.ptr();
+	}
+
+	return -1;
+}
+
+void LuauScriptInstance::push_self(lua_State *L) const {
+	if (self_ref > 0) {
+		lua_getref(L, self_ref);
+		return;
+	}
 
-			LuaStackOp<Object *>::push(ET, owner);
-			lua_insert(ET, -p_nargs - 1);
+	LuaStackOp<Object *>::push(L, owner);
 
-			int status = luascript_resume(ET, nullptr, p_nargs + 1);
+	// Keep the owner's userdata around to avoid the object cache lookup on every call.
+	// Not done for RefCounted since the userdata holds a reference to its object.
+	if (self_ref == 0)
+		self_ref = Utils::cast_obj<RefCounted>(owner->_owner) ? LUA_NOREF : lua_ref(L, -1);
+}
 
-			if (status != LUA_OK && status != LUA_YIELD) {
-				s->error("LuauScriptInstance::call_internal", LuaStackOp<String>::get(ET, -1));
+// Expects the function on top of the stack, after the arguments.
+int LuauScriptInstance::call_function(const LuauScript *p_script, const ThreadHandle &ET, int p_nargs, int p_nret) {
+	lua_insert(ET, -p_nargs - 1);
 
-				lua_pop(ET, 1);
-				return status;
-			}
+	push_self(ET);
+	lua_insert(ET, -p_nargs - 1);
 
-			lua_settop(ET, p_nret);
-			return status;
-		}
+	int status = luascript_resume(ET, nullptr, p_nargs + 1);
 
-		s = s->base.ptr();
+	if (status != LUA_OK && status != LUA_YIELD) {
+		p_script->error("LuauScriptInstance::call_internal", LuaStackOp<String>::get(ET, -1));
+
+		lua_pop(ET, 1);
+		return status;
 	}
 
-	return -1;
+	lua_settop(ET, p_nret);
+	return status;
 }
 
 bool LuauScriptInstance::set(const StringName &p_name, const Variant &p_value, PropertySetGetError *r_err) {
@@ -1075,19 +2148,18 @@ bool LuauScriptInstance::set(const StringName &p_name, const Variant &p_value, P
 
 			// Set
 			ThreadHandle T = this->T;
-			lua_State *ET = lua_newthread(T);
+			lua_State *ET = luaGD_borrowthread(T);
 			int status = LUA_OK;
 
 			if (prop.setter != StringName()) {
 				LuaStackOp<Variant>::push(ET, p_value);
 				status = call_internal(prop.setter, ET, 1, 0);
 			} else {
-				LuaStackOp<String>::push(ET, p_name);
 				LuaStackOp<Variant>::push(ET, p_value);
-				table_set(ET);
+				slot_set(ET, s->get_property_slot(E->value));
 			}
 
-			lua_pop(T, 1); // thread
+			luaGD_releasethread(T, ET);
 
 			if (status == LUA_OK || status == LUA_YIELD) {
 				if (r_err)
@@ -1107,8 +2179,8 @@ bool LuauScriptInstance::set(const StringName &p_name, const Variant &p_value, P
 			return false;
 		}
 
-		if (s->methods.has(SET_NAME)) {
-			lua_State *ET = lua_newthread(T);
+		if (s->own_callbacks & CALLBACK_SET) {
+			lua_State *ET = luaGD_borrowthread(T);
 
 			LuaStackOp<String>::push(ET, p_name);
 			LuaStackOp<Variant>::push(ET, p_value);
@@ -1123,7 +2195,7 @@ bool LuauScriptInstance::set(const StringName &p_name, const Variant &p_value, P
 							*r_err = PROP_OK;
 						}
 
-						lua_pop(T, 1); // thread
+						luaGD_releasethread(T, ET);
 						return true;
 					}
 				} else {
@@ -1132,12 +2204,12 @@ bool LuauScriptInstance::set(const StringName &p_name, const Variant &p_value, P
 					}
 
 					s->error(SET_METHOD, "Expected " SET_NAME " to return a boolean", 1);
-					lua_pop(T, 1); // thread
+					luaGD_releasethread(T, ET);
 					return false;
 				}
 			}
 
-			lua_pop(T, 1); // thread
+			luaGD_releasethread(T, ET);
 		}
 
 		s = s->base.ptr();
@@ -1171,14 +2243,13 @@ bool LuauScriptInstance::get(const StringName &p_name, Variant &r_ret, PropertyS
 
 			// Get
 			ThreadHandle T = this->T;
-			lua_State *ET = lua_newthread(T);
+			lua_State *ET = luaGD_borrowthread(T);
 			int status = LUA_OK;
 
 			if (prop.getter != StringName()) {
 				status = call_internal(prop.getter, ET, 0, 1);
 			} else {
-				LuaStackOp<String>::push(ET, p_name);
-				table_get(ET);
+				slot_get(ET, s->get_property_slot(E->value));
 			}
 
 			if (status == LUA_OK) {
@@ -1191,7 +2262,7 @@ bool LuauScriptInstance::get(const StringName &p_name, Variant &r_ret, PropertyS
 							prop.getter == StringName() ? "Table entry for '" + p_name + "' is the wrong type" : "Getter for '" + p_name + "' returned the wrong type",
 							1);
 
-					lua_pop(T, 1); // thread
+					luaGD_releasethread(T, ET);
 					return false;
 				}
 
@@ -1202,7 +2273,7 @@ bool LuauScriptInstance::get(const StringName &p_name, Variant &r_ret, PropertyS
 				if (r_err)
 					*r_err = PROP_OK;
 
-				lua_pop(T, 1); // thread
+				luaGD_releasethread(T, ET);
 				return true;
 			} else if (status == LUA_YIELD) {
 				if (r_err)
@@ -1219,12 +2290,12 @@ bool LuauScriptInstance::get(const StringName &p_name, Variant &r_ret, PropertyS
 					*r_err = PROP_GET_FAILED;
 			}
 
-			lua_pop(T, 1); // thread
+			luaGD_releasethread(T, ET);
 			return false;
 		}
 
-		if (s->methods.has(GET_NAME)) {
-			lua_State *ET = lua_newthread(T);
+		if (s->own_callbacks & CALLBACK_GET) {
+			lua_State *ET = luaGD_borrowthread(T);
 
 			LuaStackOp<String>::push(ET, p_name);
 			int status = call_internal(GET_NAME, ET, 1, 1);
@@ -1239,7 +2310,7 @@ bool LuauScriptInstance::get(const StringName &p_name, Variant &r_ret, PropertyS
 						}
 
 						r_ret = ret;
-						lua_pop(T, 1); // thread
+						luaGD_releasethread(T, ET);
 						return true;
 					}
 				} else {
@@ -1248,12 +2319,12 @@ bool LuauScriptInstance::get(const StringName &p_name, Variant &r_ret, PropertyS
 					}
 
 					s->error("LuauScriptInstance::get", "Expected " GET_NAME " to return a Variant", 1);
-					lua_pop(T, 1); // thread
+					luaGD_releasethread(T, ET);
 					return false;
 				}
 			}
 
-			lua_pop(T, 1); // thread
+			luaGD_releasethread(T, ET);
 		}
 
 		s = s->base.ptr();
@@ -1269,32 +2340,13 @@ GDExtensionPropertyInfo *LuauScriptInstance::get_property_list(uint32_t *r_count
 #define GET_PROPERTY_LIST_METHOD "LuauScriptInstance::get_property_list"
 #define GET_PROPERTY_LIST_NAME "_GetPropertyList"
 
-	LocalVector<GDExtensionPropertyInfo> properties;
 	LocalVector<GDExtensionPropertyInfo> custom_properties;
-	HashSet<StringName> defined;
 
 	const LuauScript *s = script.ptr();
 
-	// Push properties in reverse then reverse the entire vector.
-	// Ensures base properties are first.
-	// (see _get_script_property_list)
 	while (s) {
-		for (int i = s->get_definition().properties.size() - 1; i >= 0; i--) {
-			const GDClassProperty &prop = s->get_definition().properties[i];
-
-			if (defined.has(prop.property.name))
-				continue;
-
-			defined.insert(prop.property.name);
-
-			GDExtensionPropertyInfo dst;
-			copy_prop(prop.property, dst);
-
-			properties.push_back(dst);
-		}
-
-		if (s->methods.has(GET_PROPERTY_LIST_NAME)) {
-			lua_State *ET = lua_newthread(T);
+		if (s->own_callbacks & CALLBACK_GET_PROPERTY_LIST) {
+			lua_State *ET = luaGD_borrowthread(T);
 			int status = call_internal(GET_PROPERTY_LIST_NAME, ET, 0, 1);
 
 			if (status != LUA_OK) {
@@ -1346,293 +2398,814 @@ GDExtensionPropertyInfo *LuauScriptInstance::get_property_list(uint32_t *r_count
 
 					custom_properties.push_back(dst);
 				}
-			}
+			}
+
+		next:
+			luaGD_releasethread(T, ET);
+		}
+
+		s = s->base.ptr();
+	}
+
+	// Declared properties are shared, custom properties are last.
+	LuauReflection *r = script->get_reflection();
+
+	uint32_t shared_count = r->properties.size();
+	uint32_t size = shared_count + custom_properties.size();
+	*r_count = size;
+
+	GDExtensionPropertyInfo *list = alloc_property_list(r, shared_count, size);
+	r->unreference();
+
+	for (int i = custom_properties.size() - 1; i >= 0; i--)
+		list[size - 1 - i] = custom_properties[i];
+
+	return list;
+}
+
+Variant::Type LuauScriptInstance::get_property_type(const StringName &p_name, bool *r_is_valid) const {
+	const LuauScript *s = script.ptr();
+
+	while (s) {
+		HashMap<StringName, uint64_t>::ConstIterator E = s->get_definition().property_indices.find(p_name);
+
+		if (E) {
+			if (r_is_valid)
+				*r_is_valid = true;
+
+			return (Variant::Type)s->get_definition().properties[E->value].property.type;
+		}
+
+		s = s->base.ptr();
+	}
+
+	if (r_is_valid)
+		*r_is_valid = false;
+
+	return Variant::NIL;
+}
+
+bool LuauScriptInstance::property_can_revert(const StringName &p_name) {
+#define PROPERTY_CAN_REVERT_NAME "_PropertyCanRevert"
+
+	if (!script->implements(CALLBACK_PROPERTY_CAN_REVERT))
+		return false;
+
+	const LuauScript *s = script.ptr();
+
+	while (s) {
+		if (s->own_callbacks & CALLBACK_PROPERTY_CAN_REVERT) {
+			lua_State *ET = luaGD_borrowthread(T);
+
+			LuaStackOp<String>::push(ET, p_name);
+			int status = call_internal(PROPERTY_CAN_REVERT_NAME, ET, 1, 1);
+
+			if (status != OK) {
+				luaGD_releasethread(T, ET);
+				return false;
+			}
+
+			if (lua_type(ET, -1) != LUA_TBOOLEAN) {
+				s->error("LuauScriptInstance::property_can_revert", "Expected " PROPERTY_CAN_REVERT_NAME " to return a boolean", 1);
+				luaGD_releasethread(T, ET);
+				return false;
+			}
+
+			bool ret = lua_toboolean(ET, -1);
+			luaGD_releasethread(T, ET);
+			return ret;
+		}
+
+		s = s->base.ptr();
+	}
+
+	return false;
+}
+
+bool LuauScriptInstance::property_get_revert(const StringName &p_name, Variant *r_ret) {
+#define PROPERTY_GET_REVERT_NAME "_PropertyGetRevert"
+
+	if (!script->implements(CALLBACK_PROPERTY_GET_REVERT))
+		return false;
+
+	const LuauScript *s = script.ptr();
+
+	while (s) {
+		if (s->own_callbacks & CALLBACK_PROPERTY_GET_REVERT) {
+			lua_State *ET = luaGD_borrowthread(T);
+
+			LuaStackOp<String>::push(ET, p_name);
+			int status = call_internal(PROPERTY_GET_REVERT_NAME, ET, 1, 1);
+
+			if (status != OK) {
+				luaGD_releasethread(T, ET);
+				return false;
+			}
+
+			if (!LuaStackOp<Variant>::is(ET, -1)) {
+				s->error("LuauScriptInstance::property_get_revert", "Expected " PROPERTY_GET_REVERT_NAME " to return a Variant", 1);
+				luaGD_releasethread(T, ET);
+				return false;
+			}
+
+			*r_ret = LuaStackOp<Variant>::get(ET, -1);
+			luaGD_releasethread(T, ET);
+			return true;
+		}
+
+		s = s->base.ptr();
+	}
+
+	return false;
+}
+
+bool LuauScriptInstance::has_method(const StringName &p_name) const {
+	// Hidden so that the engine doesn't enable processing for grouped nodes. Direct calls still work.
+	if (process_group_index >= 0 && (p_name == process_method_name(false) || p_name == process_method_name(true)))
+		return false;
+
+	return bool(script->resolve_method(p_name));
+}
+
+void LuauScriptInstance::call(
+		const StringName &p_method,
+		const Variant *const *p_args, const GDExtensionInt p_argument_count,
+		Variant *r_return, GDExtensionCallError *r_error) {
+	LuauResolvedMethodRef resolved = script->resolve_method(p_method);
+
+	if (!resolved) {
+		r_error->error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
+		return;
+	}
+
+	const GDMethod &method = resolved->method;
+
+	// Check argument count
+	int args_allowed = resolved->arg_types.size();
+	int args_required = resolved->args_required;
+
+	if (p_argument_count < args_required) {
+		r_error->error = GDEXTENSION_CALL_ERROR_TOO_FEW_ARGUMENTS;
+		r_error->argument = args_required;
+
+		return;
+	}
+
+	if (p_argument_count > args_allowed) {
+		r_error->error = GDEXTENSION_CALL_ERROR_TOO_MANY_ARGUMENTS;
+		r_error->argument = args_allowed;
+
+		return;
+	}
+
+	// Prepare for call
+	lua_State *ET = luaGD_borrowthread(T); // execution thread
+
+	for (int i = 0; i < p_argument_count; i++) {
+		const Variant &arg = *p_args[i];
+		Variant::Type type = resolved->arg_types[i];
+
+		if (type != Variant::VARIANT_MAX && !Utils::variant_types_compatible(arg.get_type(), type)) {
+			r_error->error = GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT;
+			r_error->argument = i;
+			r_error->expected = type;
+
+			luaGD_releasethread(T, ET);
+			return;
+		}
+
+		LuaStackOp<Variant>::push(ET, arg);
+	}
+
+	for (int i = p_argument_count - args_required; i < method.default_arguments.size(); i++)
+		LuaStackOp<Variant>::push(ET, method.default_arguments[i]);
+
+	// Call
+	r_error->error = GDEXTENSION_CALL_OK;
+
+	int status = -1;
+
+	if (script->resolved_function_get(ET, *resolved))
+		status = call_function(resolved->function_script, ET, args_allowed, 1);
+
+	if (status == LUA_OK) {
+		*r_return = LuaStackOp<Variant>::get(ET, -1);
+	} else if (status == LUA_YIELD) {
+		if (method.return_val.type != GDEXTENSION_VARIANT_TYPE_NIL) {
+			luaGD_releasethread(T, ET);
+			ERR_FAIL_MSG("Non-void method yielded unexpectedly");
+		}
+
+		*r_return = Variant();
+	}
+
+	luaGD_releasethread(T, ET);
+}
+
+void LuauScriptInstance::notification(int32_t p_what) {
+#define NOTIF_NAME "_Notification"
+
+	// These notifications will fire at program exit; see ~LuauScriptInstance
+	// 3: NOTIFICATION_PREDELETE_CLEANUP (not bound)
+	if ((p_what == Object::NOTIFICATION_PREDELETE || p_what == 3) && !LuauRuntime::get_singleton()) {
+		return;
+	}
+
+	if (!script->implements(CALLBACK_NOTIFICATION))
+		return;
+
+	const LuauScript *s = script.ptr();
+
+	while (s) {
+		if (s->own_callbacks & CALLBACK_NOTIFICATION) {
+			lua_State *ET = luaGD_borrowthread(T);
+
+			LuaStackOp<int32_t>::push(ET, p_what);
+			call_internal(NOTIF_NAME, ET, 1, 0);
+
+			luaGD_releasethread(T, ET);
+		}
+
+		s = s->base.ptr();
+	}
+}
+
+void LuauScriptInstance::to_string(GDExtensionBool *r_is_valid, String *r_out) {
+#define TO_STRING_NAME "_ToString"
+
+	if (!script->implements(CALLBACK_TO_STRING))
+		return;
+
+	const LuauScript *s = script.ptr();
+
+	while (s) {
+		if (s->own_callbacks & CALLBACK_TO_STRING) {
+			lua_State *ET = luaGD_borrowthread(T);
+
+			int status = call_internal(TO_STRING_NAME, ET, 0, 1);
+
+			if (status == LUA_OK)
+				*r_out = LuaStackOp<String>::get(ET, -1);
+
+			if (r_is_valid)
+				*r_is_valid = status == LUA_OK;
+
+			luaGD_releasethread(T, ET);
+			return;
+		}
+
+		s = s->base.ptr();
+	}
+}
+
+// Until something is written, instances read from the script's prototype instead of their own table.
+void LuauScriptInstance::push_table(const ThreadHandle &T, bool p_create) const {
+	if (table_ref) {
+		lua_getref(T, table_ref);
+		return;
+	}
+
+	lua_getref(T, script->get_instance_template(T).prototype_ref);
+
+	if (p_create) {
+		lua_clonetable(T, -1);
+		lua_remove(T, -2); // prototype
+		table_ref = lua_ref(T, -1);
+	}
+}
+
+bool LuauScriptInstance::get_table(const ThreadHandle &T) const {
+	if (lua_mainthread(T) != lua_mainthread(this->T))
+		return false;
+
+	push_table(T, false);
+	return true;
+}
+
+bool LuauScriptInstance::table_set(const ThreadHandle &T) const {
+	if (lua_mainthread(T) != lua_mainthread(this->T))
+		return false;
+
+	push_table(T, true);
+	lua_insert(T, -3);
+	lua_settable(T, -3);
+	lua_remove(T, -1);
+
+	return true;
+}
+
+bool LuauScriptInstance::table_get(const ThreadHandle &T) const {
+	if (lua_mainthread(T) != lua_mainthread(this->T))
+		return false;
+
+	push_table(T, false);
+	lua_insert(T, -2);
+	lua_gettable(T, -2);
+	lua_remove(T, -2);
+
+	return true;
+}
+
+// Declared properties without accessors are stored in the array part of the table (see LuauScript::get_property_slot).
+bool LuauScriptInstance::slot_set(const ThreadHandle &T, int p_slot) const {
+	if (lua_mainthread(T) != lua_mainthread(this->T))
+		return false;
+
+	push_table(T, true);
+	lua_insert(T, -2);
+	lua_rawseti(T, -2, p_slot);
+	lua_pop(T, 1); // table
+
+	return true;
+}
+
+bool LuauScriptInstance::slot_get(const ThreadHandle &T, int p_slot) const {
+	if (lua_mainthread(T) != lua_mainthread(this->T))
+		return false;
+
+	push_table(T, false);
+	lua_rawgeti(T, -1, p_slot);
+	lua_remove(T, -2); // table
+
+	return true;
+}
+
+/* STATE SNAPSHOTS */
+
+// Layout (little endian):
+//   u32 magic, u32 version
+//   u32 property count, then (string name, value) for every stored (slot) property
+//   table entries (key, value) until SNAPSHOT_END for the remaining contents of the instance table
+// Strings are a u32 length followed by the bytes. Tables are written inline with their entries
+// and are referred to by index if they appear again (SNAPSHOT_TABLE_REF), so cycles and sharing survive.
+// Other Variant values are kept as-is in a side array which goes along with the snapshot; objects are also added to it
+// so that they are kept alive until the snapshot is restored.
+// Metatables, read-only flags, functions and other non-data values are not saved.
+
+#define SNAPSHOT_MAGIC 0x5353554c // LUSS
+#define SNAPSHOT_VERSION 2
+#define SNAPSHOT_MAX_DEPTH 64
+
+enum SnapshotTag : uint8_t {
+	SNAPSHOT_END,
+	SNAPSHOT_FALSE,
+	SNAPSHOT_TRUE,
+	SNAPSHOT_NUMBER,
+	SNAPSHOT_STRING,
+	SNAPSHOT_OBJECT, // Instance ID
+	SNAPSHOT_VARIANT, // Index in the side array
+	SNAPSHOT_TABLE,
+	SNAPSHOT_TABLE_REF
+};
+
+struct SnapshotWriter {
+	LocalVector<uint8_t> data;
+	HashMap<const void *, uint32_t> tables;
+	Array *values = nullptr;
+
+	void put_bytes(const void *p_data, uint32_t p_size) {
+		uint32_t pos = data.size();
+		data.resize(pos + p_size);
+		memcpy(data.ptr() + pos, p_data, p_size);
+	}
+
+	void put_u8(uint8_t p_val) { data.push_back(p_val); }
+	void put_u32(uint32_t p_val) { put_bytes(&p_val, sizeof(uint32_t)); }
+
+	void put_string(const char *p_str, size_t p_len) {
+		put_u32(uint32_t(p_len));
+		put_bytes(p_str, uint32_t(p_len));
+	}
+
+	static bool is_supported(lua_State *L, int p_idx) {
+		switch (lua_type(L, p_idx)) {
+			case LUA_TBOOLEAN:
+			case LUA_TNUMBER:
+			case LUA_TSTRING:
+			case LUA_TTABLE:
+				return true;
+
+			case LUA_TUSERDATA:
+				return LuaStackOp<Object *>::is(L, p_idx) || LuaStackOp<Variant>::is(L, p_idx);
+
+			default:
+				return false;
+		}
+	}
+
+	void put_value(lua_State *L, int p_idx, int p_depth) {
+		p_idx = lua_absindex(L, p_idx);
+
+		switch (lua_type(L, p_idx)) {
+			case LUA_TBOOLEAN:
+				put_u8(lua_toboolean(L, p_idx) ? SNAPSHOT_TRUE : SNAPSHOT_FALSE);
+				break;
+
+			case LUA_TNUMBER: {
+				double num = lua_tonumber(L, p_idx);
+				put_u8(SNAPSHOT_NUMBER);
+				put_bytes(&num, sizeof(double));
+			} break;
+
+			case LUA_TSTRING: {
+				size_t len = 0;
+				const char *str = lua_tolstring(L, p_idx, &len);
+				put_u8(SNAPSHOT_STRING);
+				put_string(str, len);
+			} break;
+
+			case LUA_TTABLE: {
+				const void *ptr = lua_topointer(L, p_idx);
+				HashMap<const void *, uint32_t>::ConstIterator E = tables.find(ptr);
+
+				if (E) {
+					put_u8(SNAPSHOT_TABLE_REF);
+					put_u32(E->value);
+				} else {
+					put_u8(SNAPSHOT_TABLE);
+					put_table(L, p_idx, p_depth + 1);
+				}
+			} break;
 
-		next:
-			lua_pop(T, 1); // thread
-		}
+			case LUA_TUSERDATA: {
+				if (LuaStackOp<Object *>::is(L, p_idx)) {
+					GDExtensionObjectPtr obj = LuaStackOp<Object *>::get(L, p_idx);
+					uint64_t id = obj ? internal::gdextension_interface_object_get_instance_id(obj) : 0;
 
-		s = s->base.ptr();
-	}
+					if (obj)
+						values->push_back(LuaStackOp<Variant>::get(L, p_idx));
 
-	properties.invert();
+					put_u8(SNAPSHOT_OBJECT);
+					put_bytes(&id, sizeof(uint64_t));
+				} else {
+					put_u8(SNAPSHOT_VARIANT);
+					put_u32(values->size());
+					values->push_back(LuaStackOp<Variant>::get(L, p_idx));
+				}
+			} break;
 
-	// Custom properties are last.
-	for (int i = custom_properties.size() - 1; i >= 0; i--) {
-		properties.push_back(custom_properties[i]);
+			default:
+				ERR_FAIL_MSG("Unsupported value in snapshot");
+		}
 	}
 
-	int size = properties.size();
-	*r_count = size;
+	// p_skip_slots: integer keys in [1, p_skip_slots] were already written as properties
+	void put_table(lua_State *L, int p_idx, int p_depth, int p_skip_slots = 0) {
+		p_idx = lua_absindex(L, p_idx);
+		tables.insert(lua_topointer(L, p_idx), tables.size());
 
-	GDExtensionPropertyInfo *list = (GDExtensionPropertyInfo *)memalloc(sizeof(GDExtensionPropertyInfo) * size);
-	memcpy(list, properties.ptr(), sizeof(GDExtensionPropertyInfo) * size);
+		if (p_depth > SNAPSHOT_MAX_DEPTH || !lua_checkstack(L, 4)) {
+			ERR_PRINT("Table nesting is too deep to snapshot; contents are skipped");
+			put_u8(SNAPSHOT_END);
+			return;
+		}
 
-	return list;
-}
+		lua_pushnil(L);
 
-Variant::Type LuauScriptInstance::get_property_type(const StringName &p_name, bool *r_is_valid) const {
-	const LuauScript *s = script.ptr();
+		while (lua_next(L, p_idx) != 0) {
+			bool skip = !is_supported(L, -2) || !is_supported(L, -1);
 
-	while (s) {
-		HashMap<StringName, uint64_t>::ConstIterator E = s->get_definition().property_indices.find(p_name);
+			if (!skip && p_skip_slots > 0 && lua_type(L, -2) == LUA_TNUMBER) {
+				double key = lua_tonumber(L, -2);
+				skip = key >= 1 && key <= p_skip_slots && key == int(key);
+			}
 
-		if (E) {
-			if (r_is_valid)
-				*r_is_valid = true;
+			if (!skip) {
+				put_value(L, -2, p_depth);
+				put_value(L, -1, p_depth);
+			}
 
-			return (Variant::Type)s->get_definition().properties[E->value].property.type;
+			lua_pop(L, 1); // value
 		}
 
-		s = s->base.ptr();
+		put_u8(SNAPSHOT_END);
 	}
+};
 
-	if (r_is_valid)
-		*r_is_valid = false;
+struct SnapshotReader {
+	const uint8_t *data = nullptr;
+	uint32_t size = 0;
+	uint32_t pos = 0;
+	bool error = false;
+	const Array *values = nullptr;
 
-	return Variant::NIL;
-}
+	bool has(uint32_t p_size) {
+		if (p_size > size - pos)
+			error = true;
 
-bool LuauScriptInstance::property_can_revert(const StringName &p_name) {
-#define PROPERTY_CAN_REVERT_NAME "_PropertyCanRevert"
+		return !error;
+	}
 
-	const LuauScript *s = script.ptr();
+	void get_bytes(void *r_data, uint32_t p_size) {
+		if (has(p_size)) {
+			memcpy(r_data, data + pos, p_size);
+			pos += p_size;
+		}
+	}
 
-	while (s) {
-		if (s->methods.has(PROPERTY_CAN_REVERT_NAME)) {
-			lua_State *ET = lua_newthread(T);
+	uint8_t get_u8() {
+		uint8_t val = SNAPSHOT_END;
+		get_bytes(&val, sizeof(uint8_t));
+		return val;
+	}
 
-			LuaStackOp<String>::push(ET, p_name);
-			int status = call_internal(PROPERTY_CAN_REVERT_NAME, ET, 1, 1);
+	uint32_t get_u32() {
+		uint32_t val = 0;
+		get_bytes(&val, sizeof(uint32_t));
+		return val;
+	}
 
-			if (status != OK) {
-				lua_pop(T, 1); // thread
-				return false;
-			}
+	const char *get_string(uint32_t &r_len) {
+		r_len = get_u32();
+		if (!has(r_len))
+			return nullptr;
 
-			if (lua_type(ET, -1) != LUA_TBOOLEAN) {
-				s->error("LuauScriptInstance::property_can_revert", "Expected " PROPERTY_CAN_REVERT_NAME " to return a boolean", 1);
-				lua_pop(T, 1); // thread
-				return false;
-			}
+		const char *str = (const char *)(data + pos);
+		pos += r_len;
+		return str;
+	}
 
-			bool ret = lua_toboolean(ET, -1);
-			lua_pop(T, 1); // thread
-			return ret;
+	bool header() {
+		return get_u32() == SNAPSHOT_MAGIC && get_u32() == SNAPSHOT_VERSION && !error;
+	}
+
+	bool get_value(Variant &r_ret) {
+		uint32_t idx = get_u32();
+		if (error || idx >= uint32_t(values->size())) {
+			error = true;
+			return false;
 		}
 
-		s = s->base.ptr();
+		r_ret = (*values)[idx];
+		return true;
 	}
 
-	return false;
-}
-
-bool LuauScriptInstance::property_get_revert(const StringName &p_name, Variant *r_ret) {
-#define PROPERTY_GET_REVERT_NAME "_PropertyGetRevert"
+	// Pushes the value. p_tables is a stack index of a table mapping table indices to restored tables.
+	bool push_value(lua_State *L, int p_tables, int p_depth) {
+		uint8_t tag = get_u8();
+		if (error)
+			return false;
 
-	const LuauScript *s = script.ptr();
+		switch (tag) {
+			case SNAPSHOT_FALSE:
+			case SNAPSHOT_TRUE:
+				lua_pushboolean(L, tag == SNAPSHOT_TRUE);
+				return true;
 
-	while (s) {
-		if (s->methods.has(PROPERTY_GET_REVERT_NAME)) {
-			lua_State *ET = lua_newthread(T);
+			case SNAPSHOT_NUMBER: {
+				double num = 0;
+				get_bytes(&num, sizeof(double));
+				lua_pushnumber(L, num);
+				return !error;
+			}
 
-			LuaStackOp<String>::push(ET, p_name);
-			int status = call_internal(PROPERTY_GET_REVERT_NAME, ET, 1, 1);
+			case SNAPSHOT_STRING: {
+				uint32_t len = 0;
+				const char *str = get_string(len);
+				if (!str)
+					return false;
 
-			if (status != OK) {
-				lua_pop(T, 1); // thread
-				return false;
+				lua_pushlstring(L, str, len);
+				return true;
 			}
 
-			if (!LuaStackOp<Variant>::is(ET, -1)) {
-				s->error("LuauScriptInstance::property_get_revert", "Expected " PROPERTY_GET_REVERT_NAME " to return a Variant", 1);
-				lua_pop(T, 1); // thread
-				return false;
+			case SNAPSHOT_OBJECT: {
+				uint64_t id = 0;
+				get_bytes(&id, sizeof(uint64_t));
+				LuaStackOp<Object *>::push(L, id ? ObjectDB::get_instance(id) : nullptr);
+				return !error;
 			}
 
-			*r_ret = LuaStackOp<Variant>::get(ET, -1);
-			lua_pop(T, 1); // thread
-			return true;
-		}
+			case SNAPSHOT_VARIANT: {
+				Variant value;
+				if (!get_value(value))
+					return false;
 
-		s = s->base.ptr();
-	}
+				LuaStackOp<Variant>::push(L, value);
+				return true;
+			}
 
-	return false;
-}
+			case SNAPSHOT_TABLE:
+				if (p_depth > SNAPSHOT_MAX_DEPTH || !lua_checkstack(L, 4))
+					return false;
 
-bool LuauScriptInstance::has_method(const StringName &p_name) const {
-	const LuauScript *s = script.ptr();
+				lua_newtable(L);
+				return read_table(L, lua_gettop(L), p_tables, p_depth + 1);
 
-	while (s) {
-		if (s->has_method(p_name))
-			return true;
+			case SNAPSHOT_TABLE_REF:
+				lua_rawgeti(L, p_tables, int(get_u32()) + 1);
+				return !error && lua_istable(L, -1);
 
-		s = s->base.ptr();
+			default:
+				error = true;
+				return false;
+		}
 	}
 
-	return false;
-}
+	bool read_table(lua_State *L, int p_idx, int p_tables, int p_depth) {
+		lua_pushvalue(L, p_idx);
+		lua_rawseti(L, p_tables, lua_objlen(L, p_tables) + 1);
 
-void LuauScriptInstance::call(
-		const StringName &p_method,
-		const Variant *const *p_args, const GDExtensionInt p_argument_count,
-		Variant *r_return, GDExtensionCallError *r_error) {
-	const LuauScript *s = script.ptr();
+		while (true) {
+			if (!has(1))
+				return false;
 
-	while (s) {
-		StringName actual_name = p_method;
+			if (data[pos] == SNAPSHOT_END) {
+				pos++;
+				return true;
+			}
+
+			if (!push_value(L, p_tables, p_depth))
+				return false;
 
-		// check name given and name converted to pascal
-		// (e.g. if Node::_ready is called -> _Ready)
-		if (s->has_method(p_method, &actual_name)) {
-			const GDMethod &method = s->get_definition().methods[actual_name];
+			if (!push_value(L, p_tables, p_depth)) {
+				lua_pop(L, 1); // key
+				return false;
+			}
 
-			// Check argument count
-			int args_allowed = method.arguments.size();
-			int args_default = method.default_arguments.size();
-			int args_required = args_allowed - args_default;
+			lua_rawset(L, p_idx);
+		}
+	}
 
-			if (p_argument_count < args_required) {
-				r_error->error = GDEXTENSION_CALL_ERROR_TOO_FEW_ARGUMENTS;
-				r_error->argument = args_required;
+	// Decodes a value without a Luau state. Tables cannot be represented and are skipped.
+	bool get_variant(Variant &r_ret) {
+		uint8_t tag = get_u8();
 
-				return;
-			}
+		switch (tag) {
+			case SNAPSHOT_FALSE:
+			case SNAPSHOT_TRUE:
+				r_ret = tag == SNAPSHOT_TRUE;
+				return true;
 
-			if (p_argument_count > args_allowed) {
-				r_error->error = GDEXTENSION_CALL_ERROR_TOO_MANY_ARGUMENTS;
-				r_error->argument = args_allowed;
+			case SNAPSHOT_NUMBER: {
+				double num = 0;
+				get_bytes(&num, sizeof(double));
+				r_ret = num;
+				return !error;
+			}
 
-				return;
+			case SNAPSHOT_STRING: {
+				uint32_t len = 0;
+				const char *str = get_string(len);
+				r_ret = String::utf8(str, len);
+				return str != nullptr;
 			}
 
-			// Prepare for call
-			lua_State *ET = lua_newthread(T); // execution thread
+			case SNAPSHOT_OBJECT: {
+				uint64_t id = 0;
+				get_bytes(&id, sizeof(uint64_t));
+				r_ret = id ? ObjectDB::get_instance(id) : nullptr;
+				return !error;
+			}
 
-			for (int i = 0; i < p_argument_count; i++) {
-				const Variant &arg = *p_args[i];
+			case SNAPSHOT_VARIANT:
+				return get_value(r_ret);
 
-				if (!(method.arguments[i].usage & PROPERTY_USAGE_NIL_IS_VARIANT) &&
-						!Utils::variant_types_compatible(arg.get_type(), Variant::Type(method.arguments[i].type))) {
-					r_error->error = GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT;
-					r_error->argument = i;
-					r_error->expected = method.arguments[i].type;
+			default:
+				error = true;
+				return false;
+		}
+	}
+};
 
-					lua_pop(T, 1); // thread
-					return;
-				}
+PackedByteArray LuauScriptInstance::snapshot_state(Array &r_values) const {
+	ThreadHandle T = this->T;
+	lua_State *ET = luaGD_borrowthread(T);
 
-				LuaStackOp<Variant>::push(ET, arg);
-			}
+	SnapshotWriter w;
+	w.values = &r_values;
+	w.put_u32(SNAPSHOT_MAGIC);
+	w.put_u32(SNAPSHOT_VERSION);
 
-			for (int i = p_argument_count - args_required; i < args_default; i++)
-				LuaStackOp<Variant>::push(ET, method.default_arguments[i]);
+	push_table(ET, false);
+	int table_idx = lua_gettop(ET);
 
-			// Call
-			r_error->error = GDEXTENSION_CALL_OK;
+	// Stored properties are written by name so they can be moved to their new slots on restore
+	uint32_t count_pos = w.data.size();
+	uint32_t count = 0;
+	w.put_u32(0);
 
-			int status = call_internal(actual_name, ET, args_allowed, 1);
+	for (const LuauScript *s = script.ptr(); s; s = s->base.ptr()) {
+		const GDClassDefinition &def = s->get_definition();
 
-			if (status == LUA_OK) {
-				*r_return = LuaStackOp<Variant>::get(ET, -1);
-			} else if (status == LUA_YIELD) {
-				if (method.return_val.type != GDEXTENSION_VARIANT_TYPE_NIL) {
-					lua_pop(T, 1); // thread
-					ERR_FAIL_MSG("Non-void method yielded unexpectedly");
-				}
+		for (int i = 0; i < def.properties.size(); i++) {
+			lua_rawgeti(ET, table_idx, s->get_property_slot(i));
 
-				*r_return = Variant();
+			if (!lua_isnil(ET, -1) && !lua_istable(ET, -1) && SnapshotWriter::is_supported(ET, -1)) {
+				CharString name = def.properties[i].property.name.utf8();
+				w.put_string(name.get_data(), name.length());
+				w.put_value(ET, -1, 0);
+				count++;
 			}
 
-			lua_pop(T, 1); // thread
-			return;
+			lua_pop(ET, 1); // value
 		}
-
-		s = s->base.ptr();
 	}
 
-	r_error->error = GDEXTENSION_CALL_ERROR_INVALID_METHOD;
-}
+	memcpy(w.data.ptr() + count_pos, &count, sizeof(uint32_t));
 
-void LuauScriptInstance::notification(int32_t p_what) {
-#define NOTIF_NAME "_Notification"
+	w.put_table(ET, table_idx, 0, script->get_property_slot_count());
+	lua_pop(ET, 1); // table
 
-	// These notifications will fire at program exit; see ~LuauScriptInstance
-	// 3: NOTIFICATION_PREDELETE_CLEANUP (not bound)
-	if ((p_what == Object::NOTIFICATION_PREDELETE || p_what == 3) && !LuauRuntime::get_singleton()) {
-		return;
-	}
+	luaGD_releasethread(T, ET);
 
-	const LuauScript *s = script.ptr();
+	PackedByteArray ret;
+	ret.resize(w.data.size());
+	memcpy(ret.ptrw(), w.data.ptr(), w.data.size());
 
-	while (s) {
-		if (s->methods.has(NOTIF_NAME)) {
-			lua_State *ET = lua_newthread(T);
+	return ret;
+}
 
-			LuaStackOp<int32_t>::push(ET, p_what);
-			call_internal(NOTIF_NAME, ET, 1, 0);
+bool LuauScriptInstance::restore_state(const PackedByteArray &p_snapshot, const Array &p_values) {
+	SnapshotReader r;
+	r.data = p_snapshot.ptr();
+	r.size = p_snapshot.size();
+	r.values = &p_values;
 
-			lua_pop(T, 1); // thread
-		}
+	ERR_FAIL_COND_V_MSG(!r.header(), false, "Invalid instance state snapshot");
 
-		s = s->base.ptr();
-	}
-}
+	ThreadHandle T = this->T;
+	lua_State *ET = luaGD_borrowthread(T);
 
-void LuauScriptInstance::to_string(GDExtensionBool *r_is_valid, String *r_out) {
-#define TO_STRING_NAME "_ToString"
+	// Saved entries are merged over the current table so that fields added by a newer _Init are kept
+	push_table(ET, true);
+	int table_idx = lua_gettop(ET);
 
-	const LuauScript *s = script.ptr();
+	lua_newtable(ET);
+	int tables_idx = lua_gettop(ET);
 
-	while (s) {
-		if (s->methods.has(TO_STRING_NAME)) {
-			lua_State *ET = lua_newthread(T);
+	uint32_t count = r.get_u32();
 
-			int status = call_internal(TO_STRING_NAME, ET, 0, 1);
+	// Applied through set() once the table is restored, since accessors may use other fields
+	List<Pair<StringName, Variant>> accessor_properties;
 
-			if (status == LUA_OK)
-				*r_out = LuaStackOp<String>::get(ET, -1);
+	for (uint32_t i = 0; i < count && !r.error; i++) {
+		uint32_t len = 0;
+		const char *name_str = r.get_string(len);
 
-			if (r_is_valid)
-				*r_is_valid = status == LUA_OK;
+		if (!name_str || !r.push_value(ET, tables_idx, 0)) {
+			r.error = true;
+			break;
+		}
 
-			lua_pop(T, 1); // thread
-			return;
+		StringName name = String::utf8(name_str, len);
+
+		for (const LuauScript *s = script.ptr(); s; s = s->base.ptr()) {
+			HashMap<StringName, uint64_t>::ConstIterator E = s->get_definition().property_indices.find(name);
+
+			if (E) {
+				const GDClassProperty &prop = s->get_definition().properties[E->value];
+
+				// Properties may have changed since the snapshot was taken
+				if (prop.setter != StringName() || prop.getter != StringName()) {
+					accessor_properties.push_back({ name, LuaStackOp<Variant>::get(ET, -1) });
+				} else if (LuauVariant::lua_is(ET, -1, prop.property.type)) {
+					lua_pushvalue(ET, -1);
+					lua_rawseti(ET, table_idx, s->get_property_slot(E->value));
+				}
+
+				break;
+			}
 		}
 
-		s = s->base.ptr();
+		lua_pop(ET, 1); // value
 	}
-}
 
-bool LuauScriptInstance::get_table(const ThreadHandle &T) const {
-	if (lua_mainthread(T) != lua_mainthread(this->T))
-		return false;
+	bool ok = !r.error && r.read_table(ET, table_idx, tables_idx, 0);
 
-	lua_getref(T, table_ref);
+	lua_settop(ET, table_idx - 1);
+	luaGD_releasethread(T, ET);
+
+	for (const Pair<StringName, Variant> &E : accessor_properties)
+		set(E.first, E.second);
+
+	ERR_FAIL_COND_V_MSG(!ok, false, "Instance state snapshot is truncated or corrupt; it was only partially restored");
 	return true;
 }
 
-bool LuauScriptInstance::table_set(const ThreadHandle &T) const {
-	if (lua_mainthread(T) != lua_mainthread(this->T))
-		return false;
+bool LuauScriptInstance::get_snapshot_properties(const PackedByteArray &p_snapshot, const Array &p_values, List<Pair<StringName, Variant>> &r_properties) {
+	SnapshotReader r;
+	r.data = p_snapshot.ptr();
+	r.size = p_snapshot.size();
+	r.values = &p_values;
 
-	lua_getref(T, table_ref);
-	lua_insert(T, -3);
-	lua_settable(T, -3);
-	lua_remove(T, -1);
+	ERR_FAIL_COND_V_MSG(!r.header(), false, "Invalid instance state snapshot");
 
-	return true;
-}
+	uint32_t count = r.get_u32();
 
-bool LuauScriptInstance::table_get(const ThreadHandle &T) const {
-	if (lua_mainthread(T) != lua_mainthread(this->T))
-		return false;
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t len = 0;
+		const char *name = r.get_string(len);
 
-	lua_getref(T, table_ref);
-	lua_insert(T, -2);
-	lua_gettable(T, -2);
-	lua_remove(T, -2);
+		if (!name)
+			return false;
+
+		Variant value;
+		if (!r.get_variant(value))
+			return false;
+
+		r_properties.push_back({ String::utf8(name, len), value });
+	}
 
 	return true;
 }
@@ -1691,11 +3264,13 @@ LuauScriptInstance::LuauScriptInstance(const Ref<LuauScript> &p_script, Object *
 		script(p_script), owner(p_owner), vm_type(p_vm_type) {
 #define INST_CTOR_METHOD "LuauScriptInstance::LuauScriptInstance"
 
+	// Scripts loaded on a ResourceLoader thread stop before the VM stage, which may not have run yet (see LuauCache).
+	// This can happen on any thread: `load` holds the script's load lock and the VM is locked while the tables are loaded.
+	if (p_script->get_load_stage() != LuauScript::LOAD_FULL && p_script->load(LuauScript::LOAD_FULL) != OK)
+		ERR_PRINT("Failed to load script " + p_script->get_path());
+
 	// this usually occurs in _instance_create, but that is marked const for ScriptExtension
-	{
-		MutexLock lock(*LuauLanguage::singleton->lock.ptr());
-		p_script->instances.insert(p_owner->get_instance_id(), this);
-	}
+	p_script->instances.insert(p_owner->get_instance_id(), this);
 
 	LocalVector<LuauScript *> base_scripts;
 	LuauScript *s = p_script.ptr();
@@ -1713,65 +3288,54 @@ LuauScriptInstance::LuauScriptInstance(const Ref<LuauScript> &p_script, Object *
 		CRASH_COND_MSG(SandboxService::get_singleton() && !SandboxService::get_singleton()->is_core_script(p_script->get_path()), "!!! Non-core script declared permissions !!!");
 	}
 
-	ThreadHandle L = LuauRuntime::get_singleton()->get_vm(p_vm_type);
-	T = luaGD_newthread(L, permissions);
-	luaL_sandboxthread(T);
-
-	GDThreadData *udata = luaGD_getthreaddata(T);
-	udata->script = p_script;
-
-	thread_ref = lua_ref(L, -1);
-	lua_pop(L, 1); // thread
+	// Tables must be loaded before the instance templates are built.
+	// This takes each script's load lock before the VM lock, so it is done before holding the VM below.
+	// The instance table is only created once something is written to it (see push_table).
+	for (LuauScript *&scr : base_scripts) {
+		if (scr->load_table(p_vm_type) != OK)
+			ERR_PRINT("Couldn't load script methods for " + scr->get_path());
+	}
 
-	lua_newtable(T);
-	table_ref = lua_ref(T, -1);
-	lua_pop(T, 1); // table
+	ThreadHandle L = LuauRuntime::get_singleton()->get_vm(p_vm_type);
+	T = p_script->acquire_instance_thread(L, p_vm_type, permissions);
 
+	// Run _Init for each script
 	for (LuauScript *&scr : base_scripts) {
-		// Initialize default values
-		for (const GDClassProperty &prop : scr->get_definition().properties) {
-			if (prop.getter == StringName() && prop.setter == StringName()) {
-				LuaStackOp<String>::push(T, prop.property.name);
-				LuaStackOp<Variant>::push(T, prop.default_value);
-				table_set(T);
-			}
-		}
-
-		// Run _Init for each script
-		Error method_err = scr->load_table(p_vm_type);
+		int init_ref = scr->get_instance_template(T).init_ref;
+		if (init_ref == LUA_NOREF)
+			continue;
 
-		if (method_err == OK) {
-			LuaStackOp<String>::push(T, "_Init");
-			scr->def_table_get(T);
+		lua_State *ET = luaGD_borrowthread(T);
+		lua_getref(ET, init_ref);
 
-			if (lua_isfunction(T, -1)) {
-				// This object can be considered as the full script instance (minus some initialized values) because Object sets its script
-				// before instance_create was called, and this instance was registered with the script before now.
-				LuaStackOp<Object *>::push(T, p_owner);
+		// This object can be considered as the full script instance (minus some initialized values) because Object sets its script
+		// before instance_create was called, and this instance was registered with the script before now.
+		push_self(ET);
 
-				int status = luascript_pcall(T, 1, 0, 0);
+		int status = luascript_pcall(ET, 1, 0, 0);
 
-				if (status == LUA_YIELD) {
-					p_script->error(INST_CTOR_METHOD, "_Init yielded unexpectedly");
-				} else if (status != LUA_OK) {
-					p_script->error(INST_CTOR_METHOD, "_Init failed: " + LuaStackOp<String>::get(T, -1));
-					lua_pop(T, 1);
-				}
-			} else {
-				lua_pop(T, 1);
-			}
-		} else {
-			ERR_PRINT("Couldn't load script methods for " + scr->get_path());
+		if (status == LUA_YIELD) {
+			p_script->error(INST_CTOR_METHOD, "_Init yielded unexpectedly");
+		} else if (status != LUA_OK) {
+			p_script->error(INST_CTOR_METHOD, "_Init failed: " + LuaStackOp<String>::get(ET, -1));
 		}
+
+		luaGD_releasethread(T, ET);
 	}
+
+	if (p_script->is_process_group() && Utils::cast_obj<Node>(p_owner->_owner))
+		p_script->process_group_add(this);
 }
 
 LuauScriptInstance::~LuauScriptInstance() {
 	if (script.is_valid() && owner) {
-		MutexLock lock(*LuauLanguage::singleton->lock.ptr());
 		script->instances.erase(owner->get_instance_id());
 
+		if (process_group_index >= 0)
+			script->process_group_remove(this);
+
 #ifdef TOOLS_ENABLED
+		MutexLock lock(*LuauLanguage::singleton->lock.ptr());
 		LuauLanguage::get_singleton()->instance_to_godot.erase(this);
 #endif // TOOLS_ENABLED
 	}
@@ -1782,12 +3346,16 @@ LuauScriptInstance::~LuauScriptInstance() {
 		// Check to prevent issues with unref during thread free (luaGD_close in ~LuauRuntime)
 		if (L && luaGD_getthreaddata(L)) {
 			lua_unref(L, table_ref);
-			lua_unref(L, thread_ref);
+			lua_unref(L, self_ref);
 		}
+
+		if (script.is_valid())
+			script->release_instance_thread(L, vm_type);
 	}
 
-	table_ref = -1;
-	thread_ref = -1;
+	table_ref = 0;
+	self_ref = 0;
+	T = nullptr;
 }
 
 //////////////
@@ -1868,11 +3436,11 @@ void LuauLanguage::_init() {
 	cache = memnew(LuauCache);
 
 	if (FileAccess::file_exists(INIT_LUA_PATH)) {
-		String src;
+		CharString src;
 		Error err = Utils::load_file(INIT_LUA_PATH, src);
 
 		if (err == OK) {
-			std::string bytecode = Luau::compile(src.utf8().get_data(), luaGD_compileopts());
+			std::string bytecode = Luau::compile(std::string(src.get_data(), src.length()), luaGD_compileopts());
 			ThreadHandle L = LuauRuntime::get_singleton()->get_vm(LuauRuntime::VM_CORE);
 			lua_State *T = lua_newthread(L);
 
@@ -1895,6 +3463,17 @@ void LuauLanguage::_init() {
 		}
 	}
 
+	cache->set_disk_cache_enabled(true);
+
+#ifndef TOOLS_ENABLED
+	// Scripts aren't edited or reloaded outside the editor
+	cache->set_lean_mode(true);
+#endif // TOOLS_ENABLED
+
+	// The editor loads scripts as they are opened and changes them often, so only runs are preloaded
+	if (!nb::Engine::get_singleton_nb()->is_editor_hint())
+		cache->preload_project_scripts();
+
 #ifdef TOOLS_ENABLED
 	if (nb::EngineDebugger::get_singleton_nb()->is_active())
 		debug_init();
@@ -2043,6 +3622,18 @@ void LuauLanguage::_remove_named_global_constant(const StringName &p_name) {
 	global_constants.erase(p_name);
 }
 
+#define PROCESS_GROUP_PRIORITY_SETTING "luau_script/process_groups/priority"
+
+static int process_group_priority() {
+	nb::ProjectSettings *settings = nb::ProjectSettings::get_singleton_nb();
+
+	if (!settings->has_setting(PROCESS_GROUP_PRIORITY_SETTING))
+		settings->set_setting(PROCESS_GROUP_PRIORITY_SETTING, 0);
+
+	settings->set_initial_value(PROCESS_GROUP_PRIORITY_SETTING, 0);
+	return settings->get_setting(PROCESS_GROUP_PRIORITY_SETTING);
+}
+
 void LuauLanguage::_frame() {
 	uint64_t new_ticks = nb::Time::get_singleton_nb()->get_ticks_usec();
 	double time_scale = nb::Engine::get_singleton_nb()->get_time_scale();
@@ -2051,7 +3642,59 @@ void LuauLanguage::_frame() {
 	if (ticks_usec != 0)
 		delta = (new_ticks - ticks_usec) / 1e6f;
 
+	cache->finish_pending_loads();
 	task_scheduler.frame(delta * time_scale);
 
 	ticks_usec = new_ticks;
+
+	if (!process_group_runner_added) {
+		if (SceneTree *tree = Object::cast_to<SceneTree>(nb::Engine::get_singleton_nb()->get_main_loop())) {
+			LuauProcessGroupRunner *runner = memnew(LuauProcessGroupRunner);
+			runner->set_name("LuauProcessGroupRunner");
+			// Grouped nodes check can_process themselves
+			runner->set_process_mode(Node::PROCESS_MODE_ALWAYS);
+
+			int priority = process_group_priority();
+			runner->set_process_priority(priority);
+			runner->set_physics_process_priority(priority);
+
+			// Internal, so that it doesn't show up in the root's children
+			tree->get_root()->call_deferred("add_child", runner, false, int(Node::INTERNAL_MODE_BACK));
+			process_group_runner_added = true;
+		}
+	}
+}
+
+void LuauLanguage::process_groups(bool p_physics) {
+	LocalVector<Ref<LuauScript>> scripts;
+
+	{
+		MutexLock lock(*this->lock.ptr());
+
+		for (LuauScript *script : process_group_scripts)
+			scripts.push_back(Ref<LuauScript>(script));
+	}
+
+	for (const Ref<LuauScript> &script : scripts)
+		script->run_process_group(p_physics);
+}
+
+void LuauProcessGroupRunner::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_READY:
+			set_process(true);
+			set_physics_process(true);
+			break;
+
+		case NOTIFICATION_PROCESS:
+			LuauLanguage::get_singleton()->process_groups(false);
+			break;
+
+		case NOTIFICATION_PHYSICS_PROCESS:
+			LuauLanguage::get_singleton()->process_groups(true);
+			break;
+
+		default:
+			break;
+	}
 }
@@ -5,6 +5,7 @@
 #include <gdextension_interface.h>
 #include <godot_cpp/classes/global_constants.hpp>
 #include <godot_cpp/classes/mutex.hpp>
+#include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/ref.hpp>
 #include <godot_cpp/classes/script_extension.hpp>
 #include <godot_cpp/classes/script_language_extension.hpp>
@@ -12,14 +13,21 @@
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
 #include <godot_cpp/templates/list.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 #include <godot_cpp/templates/pair.hpp>
 #include <godot_cpp/templates/self_list.hpp>
 #include <godot_cpp/templates/vector.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/char_string.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
 #include <godot_cpp/variant/packed_string_array.hpp>
 #include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/string_name.hpp>
 #include <godot_cpp/variant/typed_array.hpp>
 #include <godot_cpp/variant/variant.hpp>
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -40,9 +48,16 @@ using namespace godot;
 class PlaceHolderScriptInstance;
 #endif // TOOLS_ENABLED
 
-typedef HashMap<uint64_t, List<Pair<StringName, Variant>>> ScriptInstanceState;
+struct ScriptInstanceSavedState {
+	PackedByteArray snapshot; // LuauScriptInstance::snapshot_state
+	Array snapshot_values; // Values and objects referenced by the snapshot, kept alive until it is restored
+	List<Pair<StringName, Variant>> properties; // Placeholders
+};
+
+typedef HashMap<uint64_t, ScriptInstanceSavedState> ScriptInstanceState;
 
 class LuauCache;
+class LuauScript;
 class LuauScriptInstance;
 class LuauInterface;
 
@@ -55,12 +70,125 @@ struct LuauData {
 	LuauScriptAnalysisResult analysis_result;
 };
 
+// Callbacks the engine may invoke on any instance, whether or not the script implements them.
+enum LuauCallback {
+	CALLBACK_NOTIFICATION = 1 << 0,
+	CALLBACK_SET = 1 << 1,
+	CALLBACK_GET = 1 << 2,
+	CALLBACK_GET_PROPERTY_LIST = 1 << 3,
+	CALLBACK_PROPERTY_CAN_REVERT = 1 << 4,
+	CALLBACK_PROPERTY_GET_REVERT = 1 << 5,
+	CALLBACK_TO_STRING = 1 << 6,
+
+	CALLBACK_MAX = 7
+};
+
+// A method name given by the engine (e.g. _process), resolved against a script and its bases.
+// Reference counted since callers keep using it after the script's cache is cleared (e.g. on reload).
+struct LuauResolvedMethod {
+	std::atomic<uint32_t> refcount = 1;
+
+	bool found = false;
+	GDMethod method; // Copied, as the definition is replaced on reload
+	const LuauScript *function_script = nullptr; // Most derived script whose table defines the function
+	StringName name;
+
+	int args_required = 0;
+	LocalVector<Variant::Type> arg_types; // VARIANT_MAX if any type is accepted
+
+	// Filled on first use in each VM, while holding that VM's lock
+	mutable std::atomic<int> function_refs[LuauRuntime::VM_MAX] = {};
+
+	void reference() { refcount.fetch_add(1, std::memory_order_relaxed); }
+	void unreference();
+
+	~LuauResolvedMethod();
+};
+
+// Holds one reference to a resolved method.
+class LuauResolvedMethodRef {
+	LuauResolvedMethod *method = nullptr;
+
+public:
+	const LuauResolvedMethod *operator->() const { return method; }
+	const LuauResolvedMethod &operator*() const { return *method; }
+	explicit operator bool() const { return method != nullptr; }
+
+	LuauResolvedMethodRef &operator=(const LuauResolvedMethodRef &) = delete;
+	LuauResolvedMethodRef(const LuauResolvedMethodRef &) = delete;
+
+	LuauResolvedMethodRef(LuauResolvedMethodRef &&p_other) :
+			method(p_other.method) { p_other.method = nullptr; }
+
+	// Takes over a reference already held by the caller
+	explicit LuauResolvedMethodRef(LuauResolvedMethod *p_method = nullptr) :
+			method(p_method) {}
+
+	~LuauResolvedMethodRef() {
+		if (method)
+			method->unreference();
+	}
+};
+
+// Script instances by owner object ID. Split into shards with their own locks so that
+// instances can be created and freed from several threads (e.g. threaded scene loading) without contention.
+class LuauInstanceRegistry {
+	static const int SHARD_COUNT = 16;
+
+	struct Shard {
+		mutable std::mutex lock;
+		HashMap<uint64_t, LuauScriptInstance *> instances;
+	};
+
+	Shard shards[SHARD_COUNT];
+	std::atomic<uint32_t> count = 0;
+
+	// Object IDs start with the ObjectDB slot, which is already well distributed
+	Shard &get_shard(uint64_t p_obj_id) { return shards[p_obj_id % SHARD_COUNT]; }
+	const Shard &get_shard(uint64_t p_obj_id) const { return shards[p_obj_id % SHARD_COUNT]; }
+
+public:
+	void insert(uint64_t p_obj_id, LuauScriptInstance *p_instance);
+	void erase(uint64_t p_obj_id);
+
+	bool has(uint64_t p_obj_id) const;
+	LuauScriptInstance *get(uint64_t p_obj_id) const;
+	uint32_t size() const { return count.load(std::memory_order_relaxed); }
+
+	HashMap<uint64_t, LuauScriptInstance *> get_all() const;
+};
+
+// Reflection data for one version of a script (and its bases), built on first use.
+// Reference counted since lists handed to the engine point into it.
+struct LuauReflection {
+	std::atomic<uint32_t> refcount = 1;
+	uint64_t generation = 0;
+
+	// Instance lists, owning their strings
+	LocalVector<GDExtensionPropertyInfo> properties;
+	LocalVector<GDExtensionMethodInfo> methods;
+
+	// Script lists (read-only)
+	TypedArray<Dictionary> script_methods;
+	TypedArray<Dictionary> script_properties;
+	TypedArray<Dictionary> script_signals;
+	Dictionary rpc_config;
+	Dictionary constants;
+
+	void reference() { refcount.fetch_add(1, std::memory_order_relaxed); }
+	void unreference();
+
+	explicit LuauReflection(const LuauScript *p_script);
+	~LuauReflection();
+};
+
 class LuauScript : public ScriptExtension {
 	GDCLASS(LuauScript, ScriptExtension);
 
 	friend class LuauLanguage;
 	friend class LuauCache;
 	friend class LuauScriptInstance;
+	friend struct LuauReflection;
 #ifdef TOOLS_ENABLED
 	friend class PlaceHolderScriptInstance;
 #endif // TOOLS_ENABLED
@@ -81,11 +209,23 @@ private:
 	bool _is_module = false;
 	HashSet<Ref<LuauScript>> dependencies; // Load-time dependencies only.
 
-	String source;
+	CharString source; // UTF-8; only converted to a String when requested
+	uint64_t source_hash = 0;
 	LuauData luau_data;
 	bool source_changed_cache;
 
-	HashMap<uint64_t, LuauScriptInstance *> instances;
+	// Covers the source and, transitively, everything the definition was analyzed against.
+	uint64_t analysis_hash = 0;
+	// Set if bytecode and definition came from the disk cache (no syntax tree or analysis result)
+	bool from_disk_cache = false;
+	Array disk_cache_entry; // Read during compile, validated during analysis
+
+	String compiled_path; // .luauc file, if loaded without source (see export_compiled)
+
+	// Source and luau_data were freed after load (see LuauCache::set_lean_mode)
+	bool load_data_released = false;
+
+	LuauInstanceRegistry instances;
 #ifdef TOOLS_ENABLED
 	HashMap<uint64_t, PlaceHolderScriptInstance *> placeholders;
 	bool placeholder_fallback_enabled = false;
@@ -109,10 +249,74 @@ private:
 	HashSet<String> methods;
 	HashMap<StringName, Variant> constants;
 
+	// Taken from a global counter whenever this script's definition or tables change
+	std::atomic<uint64_t> own_generation = 0;
+	void bump_generation();
+
+	// Instance table slots before this script's properties (i.e. base properties).
+	// Follows the base chain, since bases can be reloaded on their own.
+	mutable std::atomic<int> property_slot_offset = 0;
+	mutable std::atomic<uint64_t> property_slot_generation = 0;
+	int get_property_slot_offset() const;
+
+	uint32_t own_callbacks = 0; // LuauCallback flags for this script's table only
+	mutable std::atomic<uint32_t> callbacks = 0;
+	mutable std::atomic<uint64_t> callbacks_generation = 0;
+
+	mutable HashMap<StringName, LuauResolvedMethod *> method_cache;
+	mutable uint64_t method_cache_generation = 0;
+	Ref<Mutex> method_cache_lock;
+	void clear_method_cache(LocalVector<LuauResolvedMethod *> &r_stale) const;
+
+	struct InstanceTemplate {
+		int prototype_ref = 0; // Default property values (including bases), cloned into new instance tables
+		int init_ref = 0; // _Init, or LUA_NOREF if not defined by this script
+		uint64_t generation = 0;
+	};
+
+	mutable InstanceTemplate instance_templates[LuauRuntime::VM_MAX];
+
+	struct InstanceThread {
+		lua_State *thread = nullptr;
+		int ref = 0;
+		uint32_t users = 0;
+	};
+
+	InstanceThread instance_threads[LuauRuntime::VM_MAX];
+	lua_State *acquire_instance_thread(const ThreadHandle &L, LuauRuntime::VMType p_vm_type, BitField<ThreadPermissions> p_permissions);
+	void release_instance_thread(const ThreadHandle &L, LuauRuntime::VMType p_vm_type);
+
+	void free_instance_templates();
+
+	mutable LuauReflection *reflection = nullptr;
+	Ref<Mutex> reflection_lock;
+
+	// Instances processed by LuauLanguage::process_groups (see @processGroup)
+	std::mutex process_group_lock;
+	LocalVector<LuauScriptInstance *> process_group;
+	void process_group_add(LuauScriptInstance *p_instance);
+	void process_group_remove(LuauScriptInstance *p_instance);
+	const InstanceTemplate &get_instance_template(const ThreadHandle &T) const;
+
 	LoadStage load_stage = LOAD_NONE;
+	Ref<Mutex> load_lock; // Scripts can be loaded from ResourceLoader threads
 	Error compile();
 	Error analyze();
 	Error finish_load();
+
+	void update_analysis_hash();
+	void clear_syntax_tree();
+	bool set_cache_entry(const Array &p_entry);
+	Array make_cache_entry(const std::string &p_bytecode) const;
+	bool read_disk_cache();
+	bool apply_disk_cache();
+	void save_disk_cache() const;
+	Error read_compiled_entry(Array &r_entry) const;
+	Error read_compiled();
+
+	void release_load_data(bool p_free_bytecode);
+	Error restore_source();
+	Error reload_bytecode();
 	Error try_load(lua_State *L, String *r_err = nullptr);
 
 #ifdef TOOLS_ENABLED
@@ -126,6 +330,7 @@ private:
 public:
 #endif // TESTS_ENABLED
 	ScriptInstanceState pending_reload_state;
+	void run_process_group(bool p_physics);
 
 protected:
 	static void _bind_methods() {}
@@ -134,9 +339,15 @@ public:
 	bool _has_source_code() const override;
 	String _get_source_code() const override;
 	void _set_source_code(const String &p_code) override;
+	// Falls back to a compiled script (.luauc) next to the path if there is no source
 	Error load_source_code(const String &p_path);
 
+	bool is_compiled() const { return !compiled_path.is_empty(); }
+	// Bytecode and class definition in the .luauc format, for exported projects
+	Error export_compiled(bool p_strip_debug_info, PackedByteArray &r_data);
+
 	Error load(LoadStage p_load_stage, bool p_force = false);
+	LoadStage get_load_stage() const { return load_stage; }
 	Error _reload(bool p_keep_state) override;
 
 	ScriptLanguage *_get_language() const override;
@@ -178,6 +389,8 @@ public:
 	bool instance_has(uint64_t p_obj_id) const;
 	bool _instance_has(Object *p_object) const override;
 	LuauScriptInstance *instance_get(uint64_t p_obj_id) const;
+	uint32_t get_instance_count() const { return instances.size(); }
+	bool is_process_group() const { return definition.process_group; }
 
 	/* PLACEHOLDER INSTANCE */
 	bool _is_placeholder_fallback_enabled() const override;
@@ -201,10 +414,24 @@ public:
 	int get_table_ref(LuauRuntime::VMType p_vm_type) const { return table_refs[p_vm_type]; };
 
 	const LuauData &get_luau_data() const { return luau_data; }
+	uint64_t get_analysis_hash() const { return analysis_hash; }
+	bool is_from_disk_cache() const { return from_disk_cache; }
+	// Parses the script if it was restored from the disk cache or its load data was released.
+	Error ensure_syntax_tree();
+	bool is_load_data_released() const { return load_data_released; }
 	Ref<LuauScript> get_base() const { return base; }
 
 	void def_table_get(const ThreadHandle &T) const;
+	LuauResolvedMethodRef resolve_method(const StringName &p_method) const; // Null if not found
+	uint32_t get_callbacks() const; // Includes base scripts
+	uint64_t get_generation() const; // Includes base scripts
+	LuauReflection *get_reflection() const; // Referenced, call unreference when done
+	bool implements(LuauCallback p_callback) const { return get_callbacks() & p_callback; }
+	bool resolved_function_get(const ThreadHandle &T, const LuauResolvedMethod &p_method) const;
 	const GDClassDefinition &get_definition() const { return definition; }
+	// Array index of a property (by index in definition.properties) in instance tables
+	int get_property_slot(uint64_t p_index) const { return get_property_slot_offset() + int(p_index) + 1; }
+	int get_property_slot_count() const { return get_property_slot_offset() + definition.properties.size(); }
 
 	bool is_loading() const { return _is_loading; }
 	bool is_module() const { return _is_module; }
@@ -229,9 +456,13 @@ public:
 };
 
 class ScriptInstance {
+	friend struct LuauReflection;
+
 protected:
 	static void copy_prop(const GDProperty &p_src, GDExtensionPropertyInfo &p_dst);
 	static void free_prop(const GDExtensionPropertyInfo &p_prop);
+	// Property list for the engine, starting with p_shared_count properties from p_reflection (may be null)
+	static GDExtensionPropertyInfo *alloc_property_list(LuauReflection *p_reflection, uint32_t p_shared_count, uint32_t p_count);
 
 public:
 	static void init_script_instance_info_common(GDExtensionScriptInstanceInfo3 &p_info);
@@ -269,15 +500,21 @@ public:
 };
 
 class LuauScriptInstance : public ScriptInstance {
+	friend class LuauScript;
+
 	Ref<LuauScript> script;
 	Object *owner;
 	LuauRuntime::VMType vm_type;
 	BitField<ThreadPermissions> permissions = PERMISSION_BASE;
 
-	int table_ref;
-	int thread_ref;
-	lua_State *T;
+	mutable int table_ref = 0; // Created on first write
+	mutable int self_ref = 0; // Created on first call, LUA_NOREF if not cached
+	lua_State *T; // Shared by all instances of the script in this VM
+	int process_group_index = -1;
 
+	void push_self(lua_State *L) const;
+	void push_table(const ThreadHandle &T, bool p_create) const;
+	int call_function(const LuauScript *p_script, const ThreadHandle &ET, int p_nargs, int p_nret);
 	int call_internal(const StringName &p_method, const ThreadHandle &ET, int p_nargs, int p_nret);
 
 public:
@@ -306,6 +543,14 @@ public:
 	bool get_table(const ThreadHandle &T) const;
 	bool table_set(const ThreadHandle &T) const;
 	bool table_get(const ThreadHandle &T) const;
+	bool slot_set(const ThreadHandle &T, int p_slot) const;
+	bool slot_get(const ThreadHandle &T, int p_slot) const;
+
+	// Compact binary copy of the instance table (including nested tables) for fast state transfer, e.g. across reloads.
+	PackedByteArray snapshot_state(Array &r_values) const;
+	bool restore_state(const PackedByteArray &p_snapshot, const Array &p_values);
+	// Reads only the stored properties, for when there is no instance to restore to (e.g. placeholders).
+	static bool get_snapshot_properties(const PackedByteArray &p_snapshot, const Array &p_values, List<Pair<StringName, Variant>> &r_properties);
 
 	LuauRuntime::VMType get_vm_type() const { return vm_type; }
 
@@ -366,6 +611,7 @@ class LuauLanguage : public ScriptLanguageExtension {
 
 	friend class LuauScript;
 	friend class LuauScriptInstance;
+	friend class LuauProcessGroupRunner;
 
 	// TODO: idk why these are needed, but all the other implementations have them
 	Ref<Mutex> lock;
@@ -380,6 +626,10 @@ class LuauLanguage : public ScriptLanguageExtension {
 
 	SelfList<LuauScript>::List script_list;
 
+	HashSet<LuauScript *> process_group_scripts;
+	bool process_group_runner_added = false;
+	void process_groups(bool p_physics);
+
 	HashMap<StringName, Variant> global_constants;
 
 #ifdef TOOLS_ENABLED
@@ -548,3 +798,13 @@ public:
 	LuauLanguage();
 	~LuauLanguage();
 };
+
+// Internal node that runs every process group (see @processGroup) at its own process priority.
+// Added to the root by LuauLanguage once the SceneTree exists.
+class LuauProcessGroupRunner : public Node {
+	GDCLASS(LuauProcessGroupRunner, Node);
+
+protected:
+	static void _bind_methods() {}
+	void _notification(int p_what);
+};
@@ -293,6 +293,12 @@ void LuauLanguage::debug_break(const ThreadHandle &L, bool p_is_step) {
 					lua_checkstack(L, 1);
 					lua_pushnil(L);
 					while ((lua_checkstack(L, 2), lua_next(L, -2)) != 0) {
+						// Declared properties are stored by index and were already read above
+						if (lua_type(L, -2) != LUA_TSTRING) {
+							lua_pop(L, 1); // value
+							continue;
+						}
+
 						String key = LuaStackOp<String>::get(L, -2);
 						if (!si.members.has(key)) {
 							si.members.insert(key, get_lua_val(L, -1));
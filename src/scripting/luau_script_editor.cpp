@@ -105,6 +105,7 @@ bool LuauScript::update_exports_internal(PlaceHolderScriptInstance *p_instance_t
 		if (err == OK) {
 			// Update base class
 			base = Ref<LuauScript>(definition.base_script);
+			bump_generation();
 		} else {
 			placeholder_fallback_enabled = true;
 			return false;
@@ -356,14 +357,13 @@ void LuauLanguage::_reload_tool_script(const Ref<Script> &p_script, bool p_soft_
 		if (!p_soft_reload && !script->is_module()) {
 			ScriptInstanceState &map = to_reload[script];
 
-			HashMap<uint64_t, LuauScriptInstance *> instances = script->instances;
+			HashMap<uint64_t, LuauScriptInstance *> instances = script->instances.get_all();
 
 			for (const KeyValue<uint64_t, LuauScriptInstance *> &pair : instances) {
 				Object *obj = pair.value->get_owner();
 
-				List<Pair<StringName, Variant>> state;
-				pair.value->get_property_state(state);
-				map[obj->get_instance_id()] = state;
+				ScriptInstanceSavedState &saved_state = map[obj->get_instance_id()];
+				saved_state.snapshot = pair.value->snapshot_state(saved_state.snapshot_values);
 
 				obj->set_script(Variant());
 			}
@@ -373,15 +373,13 @@ void LuauLanguage::_reload_tool_script(const Ref<Script> &p_script, bool p_soft_
 			for (const KeyValue<uint64_t, PlaceHolderScriptInstance *> &pair : placeholder_instances) {
 				Object *obj = pair.value->get_owner();
 
-				List<Pair<StringName, Variant>> state;
-				pair.value->get_property_state(state);
-				map[obj->get_instance_id()] = state;
+				pair.value->get_property_state(map[obj->get_instance_id()].properties);
 
 				obj->set_script(Variant());
 			}
 
 			// Restore state from failed reload instead
-			for (const KeyValue<uint64_t, List<Pair<StringName, Variant>>> &pair : script->pending_reload_state) {
+			for (const KeyValue<uint64_t, ScriptInstanceSavedState> &pair : script->pending_reload_state) {
 				map[pair.key] = pair.value;
 			}
 		}
@@ -394,8 +392,8 @@ void LuauLanguage::_reload_tool_script(const Ref<Script> &p_script, bool p_soft_
 
 		scr->_reload(p_soft_reload);
 
-		for (const KeyValue<uint64_t, List<Pair<StringName, Variant>>> &F : E.value) {
-			const List<Pair<StringName, Variant>> &saved_state = F.value;
+		for (const KeyValue<uint64_t, ScriptInstanceSavedState> &F : E.value) {
+			const ScriptInstanceSavedState &saved_state = F.value;
 
 			Object *obj = ObjectDB::get_instance(F.key);
 			if (!obj)
@@ -409,11 +407,17 @@ void LuauLanguage::_reload_tool_script(const Ref<Script> &p_script, bool p_soft_
 
 			obj->set_script(scr);
 
-			HashMap<uint64_t, LuauScriptInstance *>::ConstIterator G = scr->instances.find(F.key);
+			LuauScriptInstance *inst = scr->instances.get(F.key);
 
-			if (G) {
-				for (const Pair<StringName, Variant> &I : saved_state) {
-					G->value->set(I.first, I.second);
+			// Snapshots restore the whole instance table in one pass; placeholders only take properties
+			List<Pair<StringName, Variant>> properties = saved_state.properties;
+
+			if (!saved_state.snapshot.is_empty() && (!inst || !inst->restore_state(saved_state.snapshot, saved_state.snapshot_values)))
+				LuauScriptInstance::get_snapshot_properties(saved_state.snapshot, saved_state.snapshot_values, properties);
+
+			if (inst) {
+				for (const Pair<StringName, Variant> &I : properties) {
+					inst->set(I.first, I.second);
 				}
 			}
 
@@ -421,17 +425,17 @@ void LuauLanguage::_reload_tool_script(const Ref<Script> &p_script, bool p_soft_
 
 			if (H) {
 				if (scr->_is_placeholder_fallback_enabled()) {
-					for (const Pair<StringName, Variant> &I : saved_state) {
+					for (const Pair<StringName, Variant> &I : properties) {
 						H->value->property_set_fallback(I.first, I.second);
 					}
 				} else {
-					for (const Pair<StringName, Variant> &I : saved_state) {
+					for (const Pair<StringName, Variant> &I : properties) {
 						H->value->set(I.first, I.second);
 					}
 				}
 			}
 
-			if (!G && !H) {
+			if (!inst && !H) {
 				// Script load failed; save state to reload later
 				if (!scr->pending_reload_state.has(F.key)) {
 					scr->pending_reload_state[F.key] = saved_state;
@@ -455,41 +459,41 @@ bool LuauLanguage::_handles_global_class_type(const String &p_type) const {
 
 Dictionary LuauLanguage::_get_global_class_name(const String &p_path) const {
 #ifdef TOOLS_ENABLED
-	Error err = OK;
-	Ref<LuauScript> script = LuauCache::get_singleton()->get_script(p_path, err);
-	if (err != OK)
+	// Called for every script on each filesystem scan, so avoid loading scripts here.
+	LuauClassHeader header;
+	if (!LuauCache::get_singleton()->get_class_header(p_path, header))
 		return Dictionary();
 
-	const GDClassDefinition &def = script->get_definition();
-
 	Dictionary ret;
 
-	ret["name"] = def.name;
+	ret["name"] = header.name;
 
-	if (script->get_base().is_valid()) {
+	if (!header.base_path.is_empty()) {
 		// C# implementation used as reference
-		bool global_base_found = false;
-		const LuauScript *s = script->get_base().ptr();
+		String base_type;
+		String base_path = header.base_path;
 
-		while (s) {
-			const String &name = s->get_definition().name;
-			if (!name.is_empty()) {
-				ret["base_type"] = name;
-				global_base_found = true;
+		// Bounded in case of cyclic bases, which fail to load anyway
+		for (int depth = 0; depth < 64 && !base_path.is_empty(); depth++) {
+			LuauClassHeader base;
+			if (!LuauCache::get_singleton()->get_class_header(base_path, base))
+				break;
+
+			if (!base.name.is_empty()) {
+				base_type = base.name;
 				break;
 			}
 
-			s = s->get_base().ptr();
+			base_type = base.extends;
+			base_path = base.base_path;
 		}
 
-		if (!global_base_found) {
-			ret["base_type"] = script->_get_instance_base_type();
-		}
+		ret["base_type"] = base_type;
 	} else {
-		ret["base_type"] = def.extends;
+		ret["base_type"] = header.extends;
 	}
 
-	ret["icon_path"] = def.icon_path;
+	ret["icon_path"] = header.icon_path;
 
 	return ret;
 #else
@@ -639,7 +643,7 @@ GDExtensionPropertyInfo *PlaceHolderScriptInstance::get_property_list(uint32_t *
 
 	*r_count = size;
 
-	GDExtensionPropertyInfo *list = (GDExtensionPropertyInfo *)memalloc(sizeof(GDExtensionPropertyInfo) * size);
+	GDExtensionPropertyInfo *list = alloc_property_list(nullptr, 0, size);
 	memcpy(list, props.ptr(), sizeof(GDExtensionPropertyInfo) * size);
 
 	return list;
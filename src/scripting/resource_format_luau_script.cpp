@@ -16,6 +16,7 @@
 PackedStringArray ResourceFormatLoaderLuauScript::_get_recognized_extensions() const {
 	PackedStringArray extensions;
 	extensions.push_back("lua");
+	extensions.push_back("luauc");
 
 	return extensions;
 }
@@ -29,7 +30,8 @@ String ResourceFormatLoaderLuauScript::get_resource_type(const String &p_path) {
 	if (p_path == INIT_LUA_PATH)
 		return "";
 
-	return p_path.get_extension().to_lower() == "lua" ? LuauLanguage::get_singleton()->_get_type() : "";
+	String extension = p_path.get_extension().to_lower();
+	return extension == "lua" || extension == "luauc" ? LuauLanguage::get_singleton()->_get_type() : "";
 }
 
 String ResourceFormatLoaderLuauScript::_get_resource_type(const String &p_path) const {
@@ -37,6 +39,8 @@ String ResourceFormatLoaderLuauScript::_get_resource_type(const String &p_path)
 }
 
 Variant ResourceFormatLoaderLuauScript::_load(const String &p_path, const String &p_original_path, bool p_use_sub_threads, int32_t p_cache_mode) const {
+	// Scripts don't load sub-resources. On loader threads, compilation and analysis run on the calling thread
+	// and the VM stage is left for the main thread (see LuauCache::get_script).
 	Error err = OK;
 	Ref<LuauScript> script = LuauCache::get_singleton()->get_script(p_path, err, p_cache_mode == CACHE_MODE_IGNORE);
 
@@ -1,8 +1,10 @@
 #include "utils/utils.h"
 
+#include <string.h>
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/ref.hpp>
 #include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/char_string.hpp>
 #include <godot_cpp/variant/string.hpp>
 
 using namespace godot;
@@ -39,16 +41,37 @@ bool Utils::variant_types_compatible(Variant::Type p_t1, Variant::Type p_t2) {
 	return p_t1 == p_t2 || variant_types_compatible_internal(p_t1, p_t2) || variant_types_compatible_internal(p_t2, p_t1);
 }
 
-Error Utils::load_file(const String &p_path, String &r_out) {
+Error Utils::load_file(const String &p_path, CharString &r_out) {
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::ModeFlags::READ);
 	ERR_FAIL_COND_V_MSG(file.is_null(), FileAccess::get_open_error(), "Failed to read file at " + p_path);
 
 	uint64_t len = file->get_length();
-	PackedByteArray bytes = file->get_buffer(len);
-	bytes.resize(len + 1);
-	bytes[len] = 0; // EOF
+	r_out.resize(len + 1);
 
-	r_out.parse_utf8(reinterpret_cast<const char *>(bytes.ptr()));
+	uint8_t *w = reinterpret_cast<uint8_t *>(r_out.ptrw());
+	uint64_t read = file->get_buffer(w, len);
+	ERR_FAIL_COND_V_MSG(read != len, ERR_FILE_CANT_READ, "Failed to read file at " + p_path);
+
+	// Skip UTF-8 BOM
+	if (len >= 3 && w[0] == 0xef && w[1] == 0xbb && w[2] == 0xbf) {
+		memmove(w, w + 3, len - 3);
+		len -= 3;
+		r_out.resize(len + 1);
+		w = reinterpret_cast<uint8_t *>(r_out.ptrw());
+	}
+
+	w[len] = 0; // EOF
 
 	return OK;
 }
+
+uint64_t Utils::hash64(const void *p_data, size_t p_len, uint64_t p_hash) {
+	const uint8_t *data = static_cast<const uint8_t *>(p_data);
+
+	for (size_t i = 0; i < p_len; i++) {
+		p_hash ^= data[i];
+		p_hash *= 1099511628211ULL;
+	}
+
+	return p_hash;
+}
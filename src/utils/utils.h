@@ -1,6 +1,7 @@
 #pragma once
 
 #include <gdextension_interface.h>
+#include <godot_cpp/variant/char_string.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
@@ -17,5 +18,9 @@ public:
 	static String resource_type_hint(const String &p_type);
 	static bool variant_types_compatible(Variant::Type p_t1, Variant::Type p_t2);
 
-	static Error load_file(const String &p_path, String &r_out);
+	// Reads the file as raw (UTF-8) bytes, null-terminated.
+	static Error load_file(const String &p_path, CharString &r_out);
+
+	// FNV-1a. Stable across runs, unlike the engine's hashes, so it is safe to persist.
+	static uint64_t hash64(const void *p_data, size_t p_len, uint64_t p_hash = 14695981039346656037ULL);
 };
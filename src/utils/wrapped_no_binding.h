@@ -4,8 +4,10 @@
 #include <godot_cpp/classes/editor_interface.hpp>
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/engine_debugger.hpp>
+#include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/object.hpp>
 #include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/classes/ref_counted.hpp>
 #include <godot_cpp/classes/resource_loader.hpp>
 #include <godot_cpp/classes/resource_saver.hpp>
@@ -42,10 +44,12 @@ WrappedNoBinding<T> WrappedNoBinding<T>::singleton = nullptr;
 
 typedef WrappedNoBinding<godot::Object> Object;
 typedef WrappedNoBinding<godot::RefCounted> RefCounted;
+typedef WrappedNoBinding<godot::Node> Node;
 typedef WrappedNoBinding<godot::Engine> Engine;
 typedef WrappedNoBinding<godot::ResourceLoader> ResourceLoader;
 typedef WrappedNoBinding<godot::ResourceSaver> ResourceSaver;
 typedef WrappedNoBinding<godot::OS> OS;
+typedef WrappedNoBinding<godot::ProjectSettings> ProjectSettings;
 typedef WrappedNoBinding<godot::Time> Time;
 typedef WrappedNoBinding<godot::EditorInterface> EditorInterface;
 typedef WrappedNoBinding<godot::ClassDBSingleton> ClassDB;
@@ -0,0 +1,36 @@
+--- @class NestedCall
+local NestedCall = {}
+local NestedCallC = gdclass(NestedCall)
+
+export type NestedCall = RefCounted & typeof(NestedCall) & {
+    --- @signal
+    testSignal: SignalWithArgs<(arg1: integer, arg2: string) -> ()>,
+}
+
+function NestedCall:_Init()
+    self.handler1Args = ""
+    self.handler2Args = ""
+end
+
+--- @registerMethod
+function NestedCall:Handler1(arg1: integer, arg2: string)
+    -- Binding call while the arguments of Signal.emit are still live
+    str(arg1 + 10, "other", 1, 2, 3, 4, 5, 6, 7, 8)
+    self.handler1Args = str(arg1, arg2)
+end
+
+--- @registerMethod
+function NestedCall:Handler2(arg1: integer, arg2: string)
+    self.handler2Args = str(arg1, arg2)
+end
+
+--- @registerMethod
+function NestedCall:Recurse(depth: integer, tag: string): string
+    if depth == 0 then
+        return tag
+    end
+
+    return self:Call("Recurse", depth - 1, tag) .. str(depth)
+end
+
+return NestedCallC
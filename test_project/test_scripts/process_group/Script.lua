@@ -0,0 +1,38 @@
+--- @class ProcessGroup
+--- @extends Node
+--- @processGroup
+local ProcessGroup = {}
+local ProcessGroupC = gdclass(ProcessGroup)
+
+export type ProcessGroup = Node & typeof(ProcessGroup) & {
+    processed: number,
+    order: number,
+}
+
+-- Shared by all instances in the VM
+local processCount = 0
+
+function ProcessGroup:_Init()
+    self.processed = 0
+    self.order = 0
+end
+
+--- @registerMethod
+function ProcessGroup:_Process(delta: number)
+    processCount += 1
+
+    self.processed += 1
+    self.order = processCount
+end
+
+--- @registerMethod
+function ProcessGroup:GetProcessed(): number
+    return self.processed
+end
+
+--- @registerMethod
+function ProcessGroup:GetOrder(): number
+    return self.order
+end
+
+return ProcessGroupC
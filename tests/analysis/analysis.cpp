@@ -151,3 +151,41 @@ TEST_CASE("luau analysis") {
 		REQUIRE(res.definition);
 	}
 }
+
+TEST_CASE("luau analysis: class header") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+
+	SECTION("script base") {
+		LuauClassHeader header;
+		REQUIRE(luau_cache.get_class_header("res://test_scripts/analysis/TestClass.lua", header));
+		REQUIRE(header.name == "TestClass");
+		REQUIRE(header.extends.is_empty());
+		REQUIRE(header.base_path == "res://test_scripts/analysis/Base.lua");
+	}
+
+	SECTION("matches analysis") {
+		LuauClassHeader header;
+		REQUIRE(luau_cache.get_class_header("res://test_scripts/inheritance/Base.lua", header));
+
+		LOAD_SCRIPT_FILE(script, "inheritance/Base.lua")
+		const GDClassDefinition &def = script->get_definition();
+		REQUIRE(header.name == def.name);
+		REQUIRE(header.extends == def.extends);
+		REQUIRE(header.base_path.is_empty());
+	}
+
+	SECTION("no class") {
+		LuauClassHeader header;
+		REQUIRE(!luascript_scan_class_header("res://Module.mod.lua", "--- @class NotAClass\n\nlocal Module = {}\nreturn Module\n", header));
+	}
+
+	SECTION("crlf and quotes") {
+		const char *src = "local Base = require 'Base'\r\n\r\n--- @class Test\r\n--- @extends Base\r\nlocal Test = {}\r\n";
+
+		LuauClassHeader header;
+		REQUIRE(luascript_scan_class_header("res://dir/Test.lua", src, header));
+		REQUIRE(header.name == "Test");
+		REQUIRE(header.base_path == "res://dir/Base.lua");
+	}
+}
@@ -1,9 +1,16 @@
 #include <catch_amalgamated.hpp>
 
+#include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/object.hpp>
 #include <godot_cpp/core/memory.hpp>
+#include <thread>
+#include <vector>
 
+#include "core/runtime.h"
 #include "core/stack.h"
+#include "core/variant.h"
+#include "scripting/luau_cache.h"
+#include "scripting/luau_script.h"
 #include "test_utils.h"
 
 TEST_CASE_METHOD(LuauFixture, "benchmarks: object stack operations") {
@@ -39,3 +46,186 @@ TEST_CASE_METHOD(LuauFixture, "benchmarks: class bindings") {
 		luaGD_exec(L, src);
 	};
 }
+
+TEST_CASE_METHOD(LuauFixture, "benchmarks: typed array marshalling") {
+	lua_createtable(L, 10000, 0);
+
+	for (int i = 0; i < 10000; i++) {
+		LuaStackOp<Vector3>::push(L, Vector3(i, i, i));
+		lua_rawseti(L, -2, i + 1);
+	}
+
+	LuauArrayType array_type;
+	array_type.type = GDEXTENSION_VARIANT_TYPE_VECTOR3;
+
+	BENCHMARK("table to Array[Vector3]: 10000 elements") {
+		LuauVariant arr;
+		arr.lua_check_array(L, -1, array_type);
+
+		return arr.get_ptr<Array>()->size();
+	};
+
+	lua_pop(L, 1);
+}
+
+TEST_CASE_METHOD(LuauFixture, "benchmarks: string coercion") {
+	lua_pushstring(L, "global_position");
+
+	BENCHMARK("StringName from the same string 1000 times") {
+		for (int i = 0; i < 1000; i++) {
+			LuaStackOp<StringName>::check(L, -1);
+		}
+	};
+
+	lua_pop(L, 1);
+}
+
+TEST_CASE_METHOD(LuauFixture, "benchmarks: coroutines") {
+	const char *src = R"ASDF(
+        local function f() end
+
+        for i = 1, 100000 do
+            coroutine.resume(coroutine.create(f))
+        end
+    )ASDF";
+
+	BENCHMARK("create and run 100000 coroutines") {
+		luaGD_exec(L, src);
+		lua_gc(L, LUA_GCCOLLECT, 0);
+	};
+}
+
+TEST_CASE("benchmarks: nested calls") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+
+	LOAD_SCRIPT_FILE(script, "nested_call/Script.lua")
+
+	Object *obj = memnew(Object);
+	obj->set_script(script);
+
+	BENCHMARK("script calling itself through Object.call 50 levels deep") {
+		return obj->call("Recurse", 50, "x");
+	};
+
+	memdelete(obj);
+}
+
+TEST_CASE("benchmarks: script properties") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+
+	LOAD_SCRIPT_FILE(script, "instance/Script.lua")
+
+	Object *obj = memnew(Object);
+	obj->set_script(script);
+
+	LuauScriptInstance *inst = script->instance_get(obj->get_instance_id());
+	StringName prop = "testProperty4";
+	Variant val = "hello";
+
+	BENCHMARK("set and get a stored property 1000 times") {
+		Variant ret;
+
+		for (int i = 0; i < 1000; i++) {
+			inst->set(prop, val);
+			inst->get(prop, ret);
+		}
+
+		return ret;
+	};
+
+	memdelete(obj);
+}
+
+TEST_CASE("benchmarks: script instantiation") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+
+	LOAD_SCRIPT_FILE(script, "inheritance/Script.lua")
+
+	BENCHMARK("instantiate 10000 scripted nodes") {
+		Node *nodes[10000];
+
+		for (int i = 0; i < 10000; i++) {
+			nodes[i] = memnew(Node);
+			nodes[i]->set_script(script);
+		}
+
+		for (int i = 0; i < 10000; i++)
+			memdelete(nodes[i]);
+	};
+}
+
+TEST_CASE("benchmarks: threaded script instantiation") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+
+	LOAD_SCRIPT_FILE(script, "inheritance/Script.lua")
+
+	const int thread_count = 4;
+	const int per_thread = 2500;
+
+	BENCHMARK("instantiate 10000 scripted nodes from 4 threads") {
+		std::vector<std::thread> threads;
+
+		for (int t = 0; t < thread_count; t++) {
+			threads.emplace_back([&script]() {
+				Node *nodes[per_thread];
+
+				for (int i = 0; i < per_thread; i++) {
+					nodes[i] = memnew(Node);
+					nodes[i]->set_script(script);
+				}
+
+				for (int i = 0; i < per_thread; i++)
+					memdelete(nodes[i]);
+			});
+		}
+
+		for (std::thread &thread : threads)
+			thread.join();
+	};
+
+	REQUIRE(script->get_instance_count() == 0);
+}
+
+TEST_CASE("benchmarks: instance state") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+
+	LOAD_SCRIPT_FILE(script, "instance/Script.lua")
+
+	const int count = 10000;
+	std::vector<Object *> objs;
+	std::vector<LuauScriptInstance *> insts;
+
+	for (int i = 0; i < count; i++) {
+		Object *obj = memnew(Object);
+		obj->set_script(script);
+
+		objs.push_back(obj);
+		insts.push_back(script->instance_get(obj->get_instance_id()));
+	}
+
+	BENCHMARK("save and restore 10000 instances with property state") {
+		for (LuauScriptInstance *inst : insts) {
+			List<Pair<StringName, Variant>> state;
+			inst->get_property_state(state);
+
+			for (const Pair<StringName, Variant> &pair : state)
+				inst->set(pair.first, pair.second);
+		}
+	};
+
+	BENCHMARK("save and restore 10000 instances with snapshots") {
+		for (LuauScriptInstance *inst : insts) {
+			Array values;
+			PackedByteArray snapshot = inst->snapshot_state(values);
+			inst->restore_state(snapshot, values);
+		}
+	};
+
+	for (Object *obj : objs)
+		memdelete(obj);
+}
@@ -60,6 +60,18 @@ do
     assert(params2.to == Vector3.new(4, 5, 6))
     assert(params2.exclude:Size() == 0)
 
+    -- Typed array from table
+    params2.exclude = { RID.new(), RID.new() }
+    assert(params2.exclude:Size() == 2)
+
+    asserterror(function()
+        params2.exclude = { RID.new(), 1 }
+    end, "invalid array element #2 (RID expected, got number)")
+
+    -- Untyped array from table
+    params2:Callv("set", { "collide_with_areas", true })
+    assert(params2.collideWithAreas == true)
+
     -- Ref return
     params2 = nil
     gccollect()
@@ -100,6 +112,47 @@ do
     assert(styleBox.contentMarginBottom == 4.25)
 end
 
+do
+    -- Bulk property access
+    local nodes = { Node3D.new(), Node3D.new(), Node3D.new() }
+
+    local values = PackedVector3Array.new()
+    values:PushBack(Vector3.new(1, 2, 3))
+    values:PushBack(Vector3.new(4, 5, 6))
+    values:PushBack(Vector3.new(7, 8, 9))
+
+    Node3D.ScatterProperty(nodes, "position", values)
+    assert(nodes[2].position == Vector3.new(4, 5, 6))
+
+    local positions = Node3D.GatherProperty(nodes, "position")
+    assert(positions:Size() == 3)
+    assert(positions:Get(2) == Vector3.new(7, 8, 9))
+
+    -- Array userdata
+    local array = Array.new()
+    for _, node in nodes do
+        array:PushBack(node)
+    end
+
+    assert(Node3D.GatherProperty(array, "position"):Get(0) == Vector3.new(1, 2, 3))
+
+    asserterror(function()
+        Node3D.ScatterProperty(nodes, "position", PackedVector3Array.new())
+    end, "expected 3 values, got 0")
+
+    asserterror(function()
+        Node3D.GatherProperty(nodes, "rotationEdit")
+    end, "'rotationEdit' is not a valid member of Node3D")
+
+    asserterror(function()
+        Node.GatherProperty(nodes, "name")
+    end, "property 'name' has no packed array type")
+
+    for _, node in nodes do
+        node:Free()
+    end
+end
+
 do
     -- tostring
     local node = Node3D.new()
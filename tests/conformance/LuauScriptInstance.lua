@@ -71,3 +71,31 @@ do
     -- Indicates the permissions were checked
     assert(cb2:GetMethod() == "call")
 end
+
+do
+    -- Nested binding calls
+    local nestedPath = "res://test_scripts/nested_call/Script.lua"
+
+    LuauInterface.SandboxService:CoreScriptAdd(nestedPath)
+    local nestedScript = load(nestedPath) :: Script?
+    assert(nestedScript)
+
+    local nested = RefCounted.new()
+    nested:SetScript(nestedScript)
+
+    do
+        local arr = Array.new()
+        arr:PushBack(nested)
+        nested = arr:Get(0)
+    end
+
+    nested.testSignal:Connect(Callable.new(nested, "Handler1"))
+    nested.testSignal:Connect(Callable.new(nested, "Handler2"))
+    nested.testSignal:Emit(1, "hello")
+
+    assert(nested.handler1Args == "1hello")
+    assert(nested.handler2Args == "1hello")
+
+    assert(nested:Recurse(3, "x") == "x123")
+    assert(#nested:Recurse(50, "") > 0)
+end
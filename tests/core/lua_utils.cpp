@@ -1,6 +1,7 @@
 #include <catch_amalgamated.hpp>
 
 #include <lua.h>
+#include <thread>
 
 #include "core/lua_utils.h"
 #include "core/permissions.h"
@@ -37,5 +38,67 @@ TEST_CASE("vm: permissions") {
 		lua_pop(L, 1);
 	}
 
+	SECTION("recycled thread data") {
+		luaGD_newthread(L, PERMISSION_FILE);
+		lua_pop(L, 1);
+		lua_gc(L, LUA_GCCOLLECT, 0);
+
+		lua_State *T = lua_newthread(L);
+		GDThreadData *thread_udata = luaGD_getthreaddata(T);
+
+		REQUIRE(thread_udata->permissions == PERMISSION_INTERNAL);
+		REQUIRE(thread_udata->lock == udata->lock);
+		REQUIRE(thread_udata->script.is_null());
+
+		lua_pop(L, 1);
+	}
+
+	luaGD_close(L);
+}
+
+TEST_CASE("vm: thread pool") {
+	lua_State *L = luaGD_newstate(LuauRuntime::VM_MAX, PERMISSION_INTERNAL);
+	lua_State *T = luaGD_newthread(L, PERMISSION_FILE);
+
+	lua_State *ET = luaGD_borrowthread(T);
+	REQUIRE(lua_gettop(T) == 0);
+	REQUIRE(luaGD_getthreaddata(ET)->permissions == PERMISSION_FILE);
+
+	lua_pushinteger(ET, 1);
+	luaGD_releasethread(T, ET);
+
+	SECTION("threads are reused") {
+		lua_State *ET2 = luaGD_borrowthread(L);
+
+		REQUIRE(ET2 == ET);
+		REQUIRE(lua_gettop(ET2) == 0);
+		REQUIRE(luaGD_getthreaddata(ET2)->permissions == PERMISSION_INTERNAL);
+
+		luaGD_releasethread(L, ET2);
+	}
+
+	lua_pop(L, 1); // T
 	luaGD_close(L);
 }
+
+TEST_CASE("vm: lock") {
+	GDVMLock lock;
+	bool other_acquired = false;
+
+	lock.lock();
+	lock.lock(); // re-entry
+
+	std::thread other([&]() {
+		lock.lock();
+		other_acquired = true;
+		lock.unlock();
+	});
+
+	lock.unlock();
+	REQUIRE_FALSE(other_acquired);
+
+	lock.unlock();
+	other.join();
+
+	REQUIRE(other_acquired);
+}
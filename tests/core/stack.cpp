@@ -3,6 +3,7 @@
 #include <lua.h>
 #include <godot_cpp/variant/builtin_types.hpp>
 
+#include "core/lua_utils.h"
 #include "core/stack.h"
 #include "test_utils.h"
 
@@ -31,6 +32,9 @@ TEST_CASE_METHOD(LuauFixture, "vm: stack operations") {
 	test_stack_op<bool>(L, true);
 	test_stack_op<int>(L, 12);
 	test_stack_op<String>(L, "hello there! おはようございます");
+	test_stack_op<String>(L, "a string long enough to cover more than one word of ASCII");
+	test_stack_op<String>(L, String::utf8("ascii prefix, then 👋 and ü"));
+	test_stack_op<String>(L, "");
 	test_stack_op<Transform3D>(L, Transform3D().rotated(Vector3(1, 1, 1).normalized(), 2));
 
 	PackedStringArray arr = { "1", "2", "3" };
@@ -57,6 +61,35 @@ TEST_CASE_METHOD(LuauFixture, "vm: string coercion") {
 	SECTION("NodePath") {
 		ASSERT_EVAL_EQ(L, "return '../Node'", NodePath, NodePath("../Node"))
 	}
+
+	SECTION("cached conversion") {
+		lua_pushstring(L, "../Node");
+
+		REQUIRE(LuaStackOp<StringName>::check(L, -1) == StringName("../Node"));
+		REQUIRE(LuaStackOp<NodePath>::check(L, -1) == NodePath("../Node"));
+		REQUIRE(LuaStackOp<StringName>::check(L, -1) == StringName("../Node"));
+		REQUIRE(LuaStackOp<NodePath>::get(L, -1) == NodePath("../Node"));
+
+		lua_pop(L, 1);
+	}
+
+	SECTION("atoms are per VM") {
+		GDStringAtoms *atoms = luaGD_getthreaddata(L)->atoms;
+		lua_State *L2 = luaGD_newstate(LuauRuntime::VM_MAX, PERMISSION_BASE);
+
+		lua_pushstring(L, "once");
+		REQUIRE(LuaStackOp<StringName>::check(L, -1) == StringName("once"));
+		REQUIRE(atoms->entries.size() == 0);
+
+		lua_pushstring(L2, "twice");
+		REQUIRE(LuaStackOp<StringName>::check(L2, -1) == StringName("twice"));
+		REQUIRE(LuaStackOp<StringName>::check(L2, -1) == StringName("twice"));
+		REQUIRE(luaGD_getthreaddata(L2)->atoms->entries.size() == 1);
+		REQUIRE(atoms->entries.size() == 0);
+
+		luaGD_close(L2);
+		lua_pop(L, 1);
+	}
 }
 
 TEST_CASE_METHOD(LuauFixture, "vm: 64-bit integers") {
@@ -78,3 +111,35 @@ TEST_CASE_METHOD(LuauFixture, "vm: 64-bit integers") {
 		REQUIRE(lua_isuserdata(L, -1));
 	}
 }
+
+TEST_CASE_METHOD(LuauFixture, "vm: variant type discrimination") {
+	int top = lua_gettop(L);
+
+	SECTION("numbers") {
+		lua_pushnumber(L, 12);
+		REQUIRE(LuaStackOp<Variant>::get_type(L, -1) == GDEXTENSION_VARIANT_TYPE_INT);
+
+		lua_pushnumber(L, 12.5);
+		REQUIRE(LuaStackOp<Variant>::get_type(L, -1) == GDEXTENSION_VARIANT_TYPE_FLOAT);
+
+		lua_pushnumber(L, 1e300);
+		REQUIRE(LuaStackOp<Variant>::get_type(L, -1) == GDEXTENSION_VARIANT_TYPE_FLOAT);
+
+		lua_pop(L, 3);
+	}
+
+	SECTION("userdata") {
+		LuaStackOp<Vector3>::push(L, Vector3(1, 2, 3));
+		REQUIRE(LuaStackOp<Variant>::get_type(L, -1) == GDEXTENSION_VARIANT_TYPE_VECTOR3);
+
+		LuaStackOp<Array>::push(L, Array());
+		REQUIRE(LuaStackOp<Variant>::get_type(L, -1) == GDEXTENSION_VARIANT_TYPE_ARRAY);
+
+		lua_newuserdata(L, 8);
+		REQUIRE(LuaStackOp<Variant>::get_type(L, -1) == -1);
+
+		lua_pop(L, 3);
+	}
+
+	REQUIRE(lua_gettop(L) == top);
+}
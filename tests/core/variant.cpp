@@ -119,3 +119,53 @@ TEST_CASE_METHOD(LuauFixture, "luau variant") {
 	variant_test(L, GDEXTENSION_VARIANT_TYPE_OBJECT, obj, false);
 	memdelete(obj);
 }
+
+static int check_int_array(lua_State *L) {
+	LuauArrayType array_type;
+	array_type.type = GDEXTENSION_VARIANT_TYPE_INT;
+
+	LuauVariant arr;
+	arr.lua_check_array(L, 1, array_type);
+
+	LuaStackOp<int64_t>::push(L, (*arr.get_ptr<Array>())[0]);
+	return 1;
+}
+
+TEST_CASE_METHOD(LuauFixture, "luau variant: table to array") {
+	SECTION("untyped") {
+		REQUIRE(!LuauArrayType::from_type_name("").is_typed());
+		REQUIRE(!LuauArrayType::from_type_name("Array").is_typed());
+		REQUIRE(!LuauArrayType::from_type_name("Variant").is_typed());
+		REQUIRE(LuauArrayType::from_type_name("int").type == GDEXTENSION_VARIANT_TYPE_INT);
+		REQUIRE(LuauArrayType::from_type_name("Node").class_name == StringName("Node"));
+	}
+
+	lua_pushcfunction(L, check_int_array, "check_int_array");
+	lua_createtable(L, 1, 0);
+
+	SECTION("integer") {
+		lua_pushnumber(L, 12);
+		lua_rawseti(L, -2, 1);
+
+		REQUIRE(lua_pcall(L, 1, 1, 0) == LUA_OK);
+		REQUIRE(LuaStackOp<int64_t>::get(L, -1) == 12);
+	}
+
+	SECTION("non-integral number") {
+		lua_pushnumber(L, 1.5);
+		lua_rawseti(L, -2, 1);
+
+		REQUIRE(lua_pcall(L, 1, 1, 0) != LUA_OK);
+		REQUIRE(LuaStackOp<String>::get(L, -1) == "invalid array element #1 (int expected, got number)");
+	}
+
+	SECTION("numeric string") {
+		lua_pushstring(L, "12");
+		lua_rawseti(L, -2, 1);
+
+		REQUIRE(lua_pcall(L, 1, 1, 0) != LUA_OK);
+		REQUIRE(LuaStackOp<String>::get(L, -1) == "invalid array element #1 (int expected, got string)");
+	}
+
+	lua_pop(L, 1);
+}
@@ -3,12 +3,19 @@
 #include <gdextension_interface.h>
 #include <lua.h>
 #include <lualib.h>
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/global_constants.hpp>
+#include <godot_cpp/classes/node.hpp>
 #include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/classes/scene_tree.hpp>
+#include <godot_cpp/classes/window.hpp>
 #include <godot_cpp/core/memory.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/variant/builtin_types.hpp>
 #include <godot_cpp/variant/variant.hpp>
+#include <thread>
 
 #include "core/runtime.h"
 #include "core/stack.h"
@@ -60,6 +67,11 @@ TEST_CASE("luau script: script load") {
 		REQUIRE(script->_get_script_signal_list()[0].get("args").operator Array().size() == 1);
 	}
 
+	SECTION("implemented callbacks") {
+		REQUIRE_FALSE(script->implements(CALLBACK_NOTIFICATION));
+		REQUIRE_FALSE(script->implements(CALLBACK_GET));
+	}
+
 	SECTION("misc") {
 		REQUIRE(script->get_instance_base_type() == StringName("RefCounted"));
 		REQUIRE(script->_get_rpc_config().operator Dictionary().has("TestRpc"));
@@ -144,6 +156,15 @@ TEST_CASE("luau script: instance") {
 			REQUIRE(*(StringName *)properties[4].name == StringName("custom/testProperty"));
 			REQUIRE(properties[4].type == GDEXTENSION_VARIANT_TYPE_FLOAT);
 
+			// Declared properties are shared between calls
+			uint32_t count2 = 0;
+			GDExtensionPropertyInfo *properties2 = inst->get_property_list(&count2);
+
+			REQUIRE(count2 == 5);
+			REQUIRE(properties2[0].name == properties[0].name);
+			REQUIRE(properties2[4].name != properties[4].name);
+
+			inst->free_property_list(properties2, count2);
 			inst->free_property_list(properties, count);
 		}
 
@@ -159,6 +180,13 @@ TEST_CASE("luau script: instance") {
 		}
 	}
 
+	SECTION("implemented callbacks") {
+		REQUIRE(script->implements(CALLBACK_NOTIFICATION));
+		REQUIRE(script->implements(CALLBACK_TO_STRING));
+		REQUIRE(script->implements(CALLBACK_SET));
+		REQUIRE(script->implements(CALLBACK_GET_PROPERTY_LIST));
+	}
+
 	SECTION("call") {
 		SECTION("normal operation") {
 			const Variant args[] = { 2.5f, "Hello world" };
@@ -180,6 +208,22 @@ TEST_CASE("luau script: instance") {
 			inst->call("_ready", nullptr, 0, &ret, &err);
 
 			REQUIRE(err.error == GDEXTENSION_CALL_OK);
+
+			// Resolved from cache
+			inst->call("_ready", nullptr, 0, &ret, &err);
+
+			REQUIRE(err.error == GDEXTENSION_CALL_OK);
+		}
+
+		SECTION("missing method") {
+			Variant ret;
+			GDExtensionCallError err;
+
+			inst->call("_process", nullptr, 0, &ret, &err);
+			REQUIRE(err.error == GDEXTENSION_CALL_ERROR_INVALID_METHOD);
+
+			inst->call("_process", nullptr, 0, &ret, &err);
+			REQUIRE(err.error == GDEXTENSION_CALL_ERROR_INVALID_METHOD);
 		}
 
 		SECTION("default argument") {
@@ -328,6 +372,31 @@ TEST_CASE("luau script: instance") {
 			Variant new_val;
 			REQUIRE(inst->get("testProperty4", new_val));
 			REQUIRE(new_val == "asdf");
+
+			// Stored by slot, not by name
+			ThreadHandle L = LuauRuntime::get_singleton()->get_vm(LuauRuntime::VM_CORE);
+			lua_pushstring(L, "testProperty4");
+			REQUIRE(inst->table_get(L));
+			REQUIRE(lua_isnil(L, -1));
+			lua_pop(L, 1);
+		}
+
+		SECTION("separate instances") {
+			Object *obj2 = memnew(Object);
+			obj2->set_script(script);
+			LuauScriptInstance *inst2 = script->instance_get(obj2->get_instance_id());
+
+			REQUIRE(inst->set("testProperty4", "asdf"));
+
+			Variant val;
+			REQUIRE(inst2->get("testProperty4", val));
+			REQUIRE(val == "hey");
+
+			REQUIRE(inst2->set("testProperty4", "qwerty"));
+			REQUIRE(inst->get("testProperty4", val));
+			REQUIRE(val == "asdf");
+
+			memdelete(obj2);
 		}
 
 		SECTION("custom") {
@@ -353,6 +422,57 @@ TEST_CASE("luau script: instance") {
 			REQUIRE(state["testProperty4"] == "hey");
 			REQUIRE(state["custom/testProperty"] == Variant(1.25));
 		}
+
+		SECTION("state snapshot") {
+			REQUIRE(inst->set("testProperty", 3.5));
+			REQUIRE(inst->set("testProperty4", "asdf"));
+
+			// Nested table referring to itself
+			ThreadHandle L = LuauRuntime::get_singleton()->get_vm(LuauRuntime::VM_CORE);
+			lua_pushstring(L, "nested");
+			lua_newtable(L);
+			lua_pushstring(L, "value");
+			lua_setfield(L, -2, "key");
+			lua_pushvalue(L, -1);
+			lua_setfield(L, -2, "self");
+			REQUIRE(inst->table_set(L));
+
+			Array values;
+			PackedByteArray snapshot = inst->snapshot_state(values);
+
+			Object *obj2 = memnew(Object);
+			obj2->set_script(script);
+			LuauScriptInstance *inst2 = script->instance_get(obj2->get_instance_id());
+
+			REQUIRE(inst2->restore_state(snapshot, values));
+
+			Variant val;
+			REQUIRE(inst2->get("testProperty", val));
+			REQUIRE(val == Variant(7.0));
+			REQUIRE(inst2->get("testProperty4", val));
+			REQUIRE(val == "asdf");
+
+			lua_pushstring(L, "nested");
+			REQUIRE(inst2->table_get(L));
+			REQUIRE(lua_istable(L, -1));
+
+			lua_getfield(L, -1, "key");
+			REQUIRE(String(lua_tostring(L, -1)) == "value");
+			lua_pop(L, 1);
+
+			lua_getfield(L, -1, "self");
+			REQUIRE(lua_rawequal(L, -1, -2));
+			lua_pop(L, 2);
+
+			// Only stored properties are readable without an instance
+			List<Pair<StringName, Variant>> properties;
+			REQUIRE(LuauScriptInstance::get_snapshot_properties(snapshot, values, properties));
+			REQUIRE(properties.size() == 1);
+			REQUIRE(properties.front()->get().first == StringName("testProperty4"));
+			REQUIRE(properties.front()->get().second == "asdf");
+
+			memdelete(obj2);
+		}
 	}
 
 	SECTION("instantiation") {
@@ -372,6 +492,244 @@ TEST_CASE("luau script: instance") {
 	memdelete(obj);
 }
 
+TEST_CASE("luau script: preload") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+
+	PackedStringArray paths;
+	paths.push_back("res://test_scripts/inheritance/Base.lua");
+	paths.push_back("res://test_scripts/inheritance/Script.lua");
+	paths.push_back("res://test_scripts/require/Module.mod.lua");
+
+	luau_cache.preload_scripts(paths);
+
+	Error err = OK;
+	Ref<LuauScript> base = luau_cache.get_script("res://test_scripts/inheritance/Base.lua", err, false, LuauScript::LOAD_ANALYZE);
+	REQUIRE(err == OK);
+	REQUIRE(base->_is_valid());
+
+	LOAD_SCRIPT_FILE(script, "inheritance/Script.lua")
+	REQUIRE(script->get_base() == base);
+
+	LOAD_SCRIPT_MOD_FILE(module, "require/Module.mod.lua")
+	REQUIRE(module->is_module());
+}
+
+TEST_CASE("luau script: threaded load") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+
+	Ref<LuauScript> scripts[2];
+	Error errors[2] = { FAILED, FAILED };
+
+	std::thread threads[2] = {
+		std::thread([&]() {
+			scripts[0] = luau_cache.get_script("res://test_scripts/inheritance/Script.lua", errors[0]);
+		}),
+		std::thread([&]() {
+			scripts[1] = luau_cache.get_script("res://test_scripts/inheritance/Script.lua", errors[1]);
+		}),
+	};
+
+	for (std::thread &thread : threads)
+		thread.join();
+
+	// Whichever thread finds the cached script waits for the first load to finish
+	REQUIRE(errors[0] == OK);
+	REQUIRE(errors[1] == OK);
+	REQUIRE(scripts[0] == scripts[1]);
+	REQUIRE(scripts[0]->_is_valid());
+	REQUIRE(scripts[0]->get_load_stage() == LuauScript::LOAD_ANALYZE);
+
+	luau_cache.finish_pending_loads();
+	REQUIRE(scripts[0]->get_load_stage() == LuauScript::LOAD_FULL);
+	REQUIRE(scripts[0]->get_base().is_valid());
+}
+
+#define TEST_DISK_CACHE_DIR "user://luau_cache_test"
+
+// Keeps test entries out of the project's cache
+static void clear_test_disk_cache() {
+	PackedStringArray files = DirAccess::get_files_at(TEST_DISK_CACHE_DIR);
+
+	for (int i = 0; i < files.size(); i++)
+		DirAccess::remove_absolute(String(TEST_DISK_CACHE_DIR).path_join(files[i]));
+}
+
+static void use_test_disk_cache(LuauCache &p_cache) {
+	p_cache.set_disk_cache_dir(TEST_DISK_CACHE_DIR);
+	p_cache.set_disk_cache_enabled(true);
+}
+
+TEST_CASE("luau script: disk cache") {
+	LuauRuntime gd_luau;
+	clear_test_disk_cache();
+
+	Array definition;
+	std::string bytecode;
+
+	{
+		LuauCache luau_cache;
+		use_test_disk_cache(luau_cache);
+
+		LOAD_SCRIPT_FILE(script, "inheritance/Script.lua")
+		definition = script->get_definition().serialize();
+		bytecode = script->get_luau_data().bytecode;
+	}
+
+	LuauCache luau_cache;
+	use_test_disk_cache(luau_cache);
+
+	SECTION("hit") {
+		LOAD_SCRIPT_FILE(script, "inheritance/Script.lua")
+		REQUIRE(script->is_from_disk_cache());
+		REQUIRE(script->get_luau_data().bytecode == bytecode);
+		REQUIRE(script->get_definition().serialize() == definition);
+		REQUIRE(script->get_base().is_valid());
+		REQUIRE(script->get_base()->is_from_disk_cache());
+
+		SECTION("syntax tree fallback") {
+			uint64_t analysis_hash = script->get_analysis_hash();
+
+			REQUIRE(script->ensure_syntax_tree() == OK);
+			REQUIRE(script->get_luau_data().analysis_result.class_type);
+
+			// Not analyzed again
+			REQUIRE(script->is_from_disk_cache());
+			REQUIRE(script->get_analysis_hash() == analysis_hash);
+			REQUIRE(script->get_definition().serialize() == definition);
+		}
+	}
+
+	SECTION("source edit") {
+		Error err = OK;
+		Ref<LuauScript> script = luau_cache.get_script("res://test_scripts/inheritance/Script.lua", err, false, LuauScript::LOAD_NONE);
+		REQUIRE(err == OK);
+
+		script->_set_source_code(script->_get_source_code().replace("\"hihi\"", "\"haha\""));
+		REQUIRE(script->load(LuauScript::LOAD_FULL, true) == OK);
+
+		REQUIRE(!script->is_from_disk_cache());
+		REQUIRE(script->get_luau_data().bytecode != bytecode);
+		REQUIRE(script->get_base()->is_from_disk_cache());
+	}
+
+	SECTION("base edit") {
+		Error err = OK;
+		Ref<LuauScript> base = luau_cache.get_script("res://test_scripts/inheritance/Base.lua", err, false, LuauScript::LOAD_NONE);
+		REQUIRE(err == OK);
+
+		base->_set_source_code(base->_get_source_code().replace("@default \"hi\"", "@default \"hello\""));
+		REQUIRE(base->load(LuauScript::LOAD_ANALYZE, true) == OK);
+		REQUIRE(!base->is_from_disk_cache());
+
+		// The source is unchanged, but the definition depends on the base
+		LOAD_SCRIPT_FILE(script, "inheritance/Script.lua")
+		REQUIRE(!script->is_from_disk_cache());
+		REQUIRE(script->get_base() == base);
+	}
+}
+
+static void write_compiled(const String &p_path, const PackedByteArray &p_data) {
+	DirAccess::make_dir_recursive_absolute(p_path.get_base_dir());
+
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(file.is_valid());
+	file->store_buffer(p_data);
+}
+
+TEST_CASE("luau script: compiled") {
+	LuauRuntime gd_luau;
+
+	Array definition;
+	PackedByteArray data;
+	PackedByteArray require_data;
+	PackedByteArray module_data;
+
+	{
+		LuauCache luau_cache;
+
+		LOAD_SCRIPT_FILE(script, "instance/Script.lua")
+		REQUIRE(script->export_compiled(true, data) == OK);
+		definition = script->get_definition().serialize();
+
+		LOAD_SCRIPT_FILE(require_script, "require/Base.lua")
+		REQUIRE(require_script->export_compiled(true, require_data) == OK);
+
+		LOAD_SCRIPT_MOD_FILE(module, "require/Module.mod.lua")
+		REQUIRE(module->export_compiled(true, module_data) == OK);
+	}
+
+	// Only the compiled files exist, as in an exported project
+	write_compiled("user://luau_compiled/Script.luauc", data);
+	write_compiled("user://luau_compiled/require/Base.luauc", require_data);
+	write_compiled("user://luau_compiled/require/Module.mod.luauc", module_data);
+
+	LuauCache luau_cache;
+
+	Error err = OK;
+	Ref<LuauScript> script = luau_cache.get_script("user://luau_compiled/Script.luauc", err);
+	REQUIRE(err == OK);
+	REQUIRE(script->_is_valid());
+	REQUIRE(script->is_compiled());
+	REQUIRE(!script->_has_source_code());
+	REQUIRE(script->get_path() == "user://luau_compiled/Script.lua");
+	REQUIRE(script->get_load_stage() == LuauScript::LOAD_FULL);
+	REQUIRE(script->get_definition().serialize() == definition);
+
+	SECTION("require") {
+		Ref<LuauScript> require_script = luau_cache.get_script("user://luau_compiled/require/Base.lua", err);
+		REQUIRE(err == OK);
+		REQUIRE(require_script->_is_valid());
+		REQUIRE(require_script->_get_constants()["TEST_CONSTANT"] == Variant("hello"));
+	}
+
+	SECTION("lean mode") {
+		luau_cache.set_lean_mode(true);
+		REQUIRE(script->load(LuauScript::LOAD_FULL, true) == OK);
+		REQUIRE(script->get_luau_data().bytecode.empty());
+
+		// Read back from the .luauc file
+		REQUIRE(script->load_table(LuauRuntime::VM_USER) == OK);
+		REQUIRE(script->get_table_ref(LuauRuntime::VM_USER));
+	}
+}
+
+TEST_CASE("luau script: lean mode") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+	luau_cache.set_lean_mode(true);
+
+	LOAD_SCRIPT_FILE(script, "inheritance/Script.lua")
+	REQUIRE(script->is_load_data_released());
+	REQUIRE(!script->get_luau_data().parse_result.root);
+
+	// Only compiled scripts can read their bytecode back without compiling
+	std::string bytecode = script->get_luau_data().bytecode;
+	REQUIRE(!bytecode.empty());
+	REQUIRE(script->get_base()->is_load_data_released());
+
+	SECTION("source") {
+		REQUIRE(script->_has_source_code());
+		REQUIRE(!script->_get_source_code().is_empty());
+	}
+
+	SECTION("table load") {
+		REQUIRE(script->load_table(LuauRuntime::VM_USER) == OK);
+		REQUIRE(script->get_table_ref(LuauRuntime::VM_USER));
+		REQUIRE(script->get_luau_data().bytecode == bytecode);
+	}
+
+	SECTION("syntax tree") {
+		Array definition = script->get_definition().serialize();
+
+		REQUIRE(script->ensure_syntax_tree() == OK);
+		REQUIRE(script->get_luau_data().analysis_result.class_type);
+		REQUIRE(script->is_load_data_released());
+		REQUIRE(script->get_definition().serialize() == definition);
+	}
+}
+
 TEST_CASE("luau script: inheritance") {
 	LuauRuntime gd_luau;
 	LuauCache luau_cache;
@@ -408,6 +766,18 @@ TEST_CASE("luau script: inheritance") {
 		SECTION("overridden") {
 			ASSERT_EVAL_EQ(T, "return obj:Method2()", String, "guy");
 		}
+
+		SECTION("script property list") {
+			TypedArray<Dictionary> props = script->_get_script_property_list();
+
+			REQUIRE(props.size() == 2);
+			REQUIRE(props[0].get("name") == "property1");
+			REQUIRE(props[1].get("name") == "property2");
+
+			// Shared between calls, so entries can't be modified
+			REQUIRE(props.is_read_only());
+			REQUIRE(props[0].operator Dictionary().is_read_only());
+		}
 	}
 
 	SECTION("IsScript") {
@@ -431,6 +801,76 @@ TEST_CASE("luau script: inheritance") {
 	memdelete(obj);
 }
 
+TEST_CASE("luau script: process group") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+
+	LOAD_SCRIPT_FILE(script, "process_group/Script.lua")
+
+	REQUIRE(script->is_process_group());
+
+	Node *node = memnew(Node);
+	node->set_script(script);
+
+	// Hidden so that the engine doesn't process the node itself
+	LuauScriptInstance *inst = script->instance_get(node->get_instance_id());
+	REQUIRE(!inst->has_method("_process"));
+
+	SECTION("direct call") {
+		const Variant delta = 0.5;
+		const Variant *pargs[] = { &delta };
+		Variant ret;
+		GDExtensionCallError err;
+
+		inst->call("_process", pargs, 1, &ret, &err);
+		REQUIRE(err.error == GDEXTENSION_CALL_OK);
+		REQUIRE(node->call("GetProcessed") == Variant(1.0));
+
+		// Not swallowed by the group
+		inst->call("_process", pargs, 1, &ret, &err);
+		REQUIRE(node->call("GetProcessed") == Variant(2.0));
+	}
+
+	SECTION("outside of the tree") {
+		script->run_process_group(false);
+		REQUIRE(node->call("GetProcessed") == Variant(0.0));
+	}
+
+	SECTION("inside a tree") {
+		// Tests run before the main loop exists, so this tree is never processed by the engine
+		SceneTree *tree = memnew(SceneTree);
+
+		Node *other = memnew(Node);
+		other->set_script(script);
+		other->set_process_priority(-1);
+
+		tree->get_root()->add_child(node);
+		tree->get_root()->add_child(other);
+		REQUIRE(!node->is_processing());
+
+		LuauProcessGroupRunner *runner = memnew(LuauProcessGroupRunner);
+		tree->get_root()->add_child(runner);
+		REQUIRE(runner->is_processing());
+
+		runner->notification(Node::NOTIFICATION_PROCESS);
+		REQUIRE(node->call("GetProcessed") == Variant(1.0));
+		REQUIRE(other->call("GetProcessed") == Variant(1.0));
+
+		// Ordered by process priority
+		REQUIRE(int(other->call("GetOrder")) < int(node->call("GetOrder")));
+
+		node->set_process_mode(Node::PROCESS_MODE_DISABLED);
+		runner->notification(Node::NOTIFICATION_PROCESS);
+		REQUIRE(node->call("GetProcessed") == Variant(1.0));
+		REQUIRE(other->call("GetProcessed") == Variant(2.0));
+
+		tree->get_root()->remove_child(node);
+		memdelete(tree); // Frees other and runner
+	}
+
+	memdelete(node);
+}
+
 TEST_CASE("luau script: base script loading") {
 	LuauRuntime gd_luau;
 	LuauCache luau_cache;
@@ -442,6 +882,60 @@ TEST_CASE("luau script: base script loading") {
 		REQUIRE(script->get_base() == script_base);
 	}
 
+	SECTION("generation") {
+		uint64_t base_generation = script_base->get_generation();
+		uint64_t generation = script->get_generation();
+
+		REQUIRE(generation >= base_generation);
+
+		// Base changes reach derived scripts
+		script_base->_reload(true);
+
+		REQUIRE(script_base->get_generation() > base_generation);
+		REQUIRE(script->get_generation() > generation);
+
+		// Derived changes don't reach bases
+		base_generation = script_base->get_generation();
+		script->_reload(true);
+
+		REQUIRE(script_base->get_generation() == base_generation);
+	}
+
+	SECTION("property slots follow base reload") {
+		REQUIRE(script->get_property_slot_count() == 0);
+
+		// Only the base is reloaded
+		String orig_src = script_base->_get_source_code();
+		script_base->_set_source_code(orig_src.replace("export type Base = Node & typeof(Base)", "export type Base = Node & typeof(Base) & {\n\t--- @property\n\tvalue: number,\n}"));
+		script_base->_reload(true);
+
+		REQUIRE(script_base->get_property_slot_count() == 1);
+		REQUIRE(script->get_property_slot_count() == 1);
+
+		script_base->_set_source_code(orig_src);
+		script_base->_reload(true);
+
+		REQUIRE(script->get_property_slot_count() == 0);
+	}
+
+	SECTION("resolved method across reload") {
+		String orig_src = script_base->_get_source_code();
+		script_base->_set_source_code(orig_src.replace("--@1", "--- @registerMethod\nfunction Base:GetValue(): number\n\treturn 1\nend"));
+		script_base->_reload(true);
+
+		LuauResolvedMethodRef method = script->resolve_method("GetValue");
+		REQUIRE(method);
+		REQUIRE(method->function_script == script_base.ptr());
+
+		// The cache is cleared on the next lookup, but held entries stay valid
+		script_base->_set_source_code(orig_src);
+		script_base->_reload(true);
+
+		REQUIRE(!script->resolve_method("GetValue"));
+		REQUIRE(method->name == StringName("GetValue"));
+		REQUIRE(method->method.return_val.type == GDEXTENSION_VARIANT_TYPE_FLOAT);
+	}
+
 	SECTION("base invalid") {
 		String orig_src = script_base->_get_source_code();
 		String new_src = orig_src.replace("--@1", "@#%^!@*&#syntaxerror");
@@ -552,6 +1046,75 @@ TEST_CASE("luau script: placeholders") {
 	memdelete(obj);
 }
 
+TEST_CASE("luau script: state snapshots") {
+	LuauRuntime gd_luau;
+	LuauCache luau_cache;
+
+	LOAD_SCRIPT_FILE(script_base, "placeholder/Base.lua")
+	LOAD_SCRIPT_FILE(script, "placeholder/Script.lua")
+
+	String new_src = script->_get_source_code().replace("--@1", R"ASDF(
+                    --- @property
+                    testObject: RefCounted?,
+                )ASDF");
+	script->_set_source_code(new_src);
+	REQUIRE(script->_reload(true) == OK);
+
+	Node *node = memnew(Node);
+	node->set_script(script);
+	LuauScriptInstance *inst = script->instance_get(node->get_instance_id());
+
+	Ref<RefCounted> ref;
+	ref.instantiate();
+
+	REQUIRE(inst->set("testProperty", 1.5));
+	REQUIRE(inst->set("testObject", ref));
+
+	Array values;
+	PackedByteArray snapshot = inst->snapshot_state(values);
+
+	// Held by the snapshot until it is restored
+	REQUIRE(values.has(ref));
+
+	SECTION("restore") {
+		Node *node2 = memnew(Node);
+		node2->set_script(script);
+		LuauScriptInstance *inst2 = script->instance_get(node2->get_instance_id());
+
+		REQUIRE(inst2->restore_state(snapshot, values));
+
+		Variant val;
+		REQUIRE(inst2->get("testProperty", val));
+		REQUIRE(val == Variant(1.5));
+		REQUIRE(inst2->get("testObject", val));
+		REQUIRE(val == Variant(ref));
+
+		memdelete(node2);
+	}
+
+	SECTION("placeholder") {
+		List<Pair<StringName, Variant>> properties;
+		REQUIRE(LuauScriptInstance::get_snapshot_properties(snapshot, values, properties));
+
+		Object *obj = memnew(Object);
+		PlaceHolderScriptInstance *placeholder = memnew(PlaceHolderScriptInstance(script, obj));
+
+		for (const Pair<StringName, Variant> &E : properties)
+			REQUIRE(placeholder->set(E.first, E.second));
+
+		Variant val;
+		REQUIRE(placeholder->get("testProperty", val));
+		REQUIRE(val == Variant(1.5));
+		REQUIRE(placeholder->get("testObject", val));
+		REQUIRE(val == Variant(ref));
+
+		memdelete(placeholder);
+		memdelete(obj);
+	}
+
+	memdelete(node);
+}
+
 TEST_CASE("luau script: require") {
 	LuauRuntime gd_luau;
 	LuauCache luau_cache;